@@ -0,0 +1,807 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Benchmark program for mdz_ansi and mdz_ansi_ext functions. Reproduces workloads of "Performance Comparison" tables of README.md (find, firstOf)
+ * and measures also rfind, insert, replace, count, trim, copySubAnsi, asynchronous calls and overhead of call statistics. mdz_ansi results are compared
+ * with std::string, strstr(), memchr() and strcspn(). Results are written in JSON format.
+ *
+ * Build (Linux, from repository root):
+ *   g++ -O2 -std=c++11 -I. -Iext bench/mdz_ansi_bench.cpp ext/mdz_ansi_ext_*.c -o mdz_ansi_bench -LLinux/x64 -lmdz_ansi -lpthread
+ * Build (Windows, Visual Studio command prompt, from repository root):
+ *   cl /O2 /EHsc /I. /Iext bench\mdz_ansi_bench.cpp ext\mdz_ansi_ext_*.c Win64\v140-shared\mdz_ansi.lib
+ *
+ * Define MDZ_ANSI_EXT_STATS (-DMDZ_ANSI_EXT_STATS, /DMDZ_ANSI_EXT_STATS) to run also "stats" workloads.
+ *
+ * Usage:
+ *   mdz_ansi_bench --license <file> [--sizes 1M,100M] [--threads 1,2,4] [--repeat 5] [--filter find] [--all] [--out result.json]
+ *
+ * License file contains 4 lines with hash codes of first name, last name, e-mail and license, which are passed to mdz_ansi_init().
+ * Hash codes in line are separated with spaces or commas, decimal or hexadecimal (0x...) numbers are accepted.
+ * --sizes   - sizes of "long string" (K and M suffixes are accepted). Default is 100M as in README.md tables
+ * --threads - numbers of concurrent asynchronous calls for "async" workloads. Default is 1,2,4
+ * --repeat  - number of measurements of every workload. Minimum and median times are reported. Default is 3
+ * --filter  - run only workloads which group name contains given text
+ * --all     - also run quadratic implementations (clib, brute, std::string, strstr()) with long sub-strings. They need minutes on 100M strings
+ * --out     - output file. Default is standard output
+ *
+ */
+
+#include "mdz_ansi.h"
+#include "mdz_ansi_ext.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Options
+{
+  std::vector<size_t> m_vecSizes;
+  std::vector<size_t> m_vecThreads;
+  size_t m_nRepeat;
+  std::string m_strFilter;
+  std::string m_strOut;
+  std::string m_strLicense;
+  bool m_bAll;
+
+  Options() : m_nRepeat(3), m_bAll(false)
+  {
+  }
+};
+
+struct Result
+{
+  std::string m_strGroup;
+  std::string m_strTest;
+  std::string m_strImpl;
+  size_t m_nSize;
+  size_t m_nThreads;
+  std::vector<double> m_vecMicros;
+  size_t m_nValue;
+};
+
+/**
+ * Size label as used in README.md tables: 1K, 500K, 100M
+ */
+std::string sizeLabel(size_t nSize)
+{
+  std::ostringstream oss;
+
+  if (nSize >= 1024 * 1024 && 0 == nSize % (1024 * 1024))
+  {
+    oss << nSize / (1024 * 1024) << "M";
+  }
+  else if (nSize >= 1024 && 0 == nSize % 1024)
+  {
+    oss << nSize / 1024 << "K";
+  }
+  else
+  {
+    oss << nSize;
+  }
+
+  return oss.str();
+}
+
+bool parseSize(const std::string& str, size_t& nSize)
+{
+  char* pEnd = NULL;
+  unsigned long long nValue = strtoull(str.c_str(), &pEnd, 10);
+
+  if (pEnd == str.c_str())
+  {
+    return false;
+  }
+
+  if ('K' == *pEnd || 'k' == *pEnd)
+  {
+    nValue *= 1024;
+    ++pEnd;
+  }
+  else if ('M' == *pEnd || 'm' == *pEnd)
+  {
+    nValue *= 1024 * 1024;
+    ++pEnd;
+  }
+
+  nSize = (size_t) nValue;
+  return 0 == *pEnd && nValue > 0;
+}
+
+bool parseList(const char* pcList, std::vector<size_t>& vecOut)
+{
+  std::stringstream ss(pcList);
+  std::string strItem;
+  size_t nValue;
+
+  vecOut.clear();
+  while (std::getline(ss, strItem, ','))
+  {
+    if (!parseSize(strItem, nValue))
+    {
+      return false;
+    }
+    vecOut.push_back(nValue);
+  }
+
+  return !vecOut.empty();
+}
+
+bool initLibrary(const std::string& strLicense)
+{
+  std::ifstream oFile(strLicense.c_str());
+  std::vector<uint32_t> vecHashes[4];
+  std::string strLine;
+  size_t i;
+
+  for (i = 0; i < 4 && std::getline(oFile, strLine); ++i)
+  {
+    std::replace(strLine.begin(), strLine.end(), ',', ' ');
+    std::istringstream iss(strLine);
+    std::string strHash;
+
+    while (iss >> strHash)
+    {
+      vecHashes[i].push_back((uint32_t) strtoul(strHash.c_str(), NULL, 0));
+    }
+  }
+
+  if (i < 4)
+  {
+    fprintf(stderr, "license file \"%s\" should contain 4 lines with hash codes\n", strLicense.c_str());
+    return false;
+  }
+
+  return mdz_true == mdz_ansi_init(vecHashes[0].data(), vecHashes[1].data(), vecHashes[2].data(), vecHashes[3].data());
+}
+
+void waitAsync(struct mdz_asyncData* pAsyncData)
+{
+#ifdef _WIN32
+  WaitForSingleObject(pAsyncData->m_hThread, INFINITE);
+  CloseHandle(pAsyncData->m_hThread);
+#else
+  pthread_join(pAsyncData->m_hThread, NULL);
+#endif
+}
+
+/**
+ * mdz_ansi string filled with nSize items of cItem, with cEdge on the last (or first if bFront is true) position
+ */
+struct mdz_Ansi* createAnsi(size_t nSize, char cItem, char cEdge, bool bFront)
+{
+  struct mdz_Ansi* pAnsi = mdz_ansi_create(0);
+
+  if (NULL == pAnsi || !mdz_ansi_reserveAndInit(pAnsi, nSize, cItem))
+  {
+    fprintf(stderr, "cannot create string of %lu items\n", (unsigned long) nSize);
+    exit(1);
+  }
+
+  pAnsi->m_pData[bFront ? 0 : nSize - 1] = cEdge;
+  return pAnsi;
+}
+
+class Bench
+{
+public:
+  explicit Bench(const Options& oOptions) : m_oOptions(oOptions)
+  {
+  }
+
+  bool enabled(const char* pcGroup) const
+  {
+    return m_oOptions.m_strFilter.empty() || std::string(pcGroup).find(m_oOptions.m_strFilter) != std::string::npos;
+  }
+
+  /**
+   * Measure fnRun m_nRepeat times. fnPrepare is called before every measurement and is not measured
+   */
+  template <class Prepare, class Run>
+  void run(const char* pcGroup, const std::string& strTest, const char* pcImpl, size_t nSize, size_t nThreads, Prepare fnPrepare, Run fnRun)
+  {
+    Result oResult;
+    size_t i;
+
+    oResult.m_strGroup = pcGroup;
+    oResult.m_strTest = strTest;
+    oResult.m_strImpl = pcImpl;
+    oResult.m_nSize = nSize;
+    oResult.m_nThreads = nThreads;
+    oResult.m_nValue = 0;
+
+    for (i = 0; i < m_oOptions.m_nRepeat; ++i)
+    {
+      fnPrepare();
+
+      std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+      oResult.m_nValue = fnRun();
+      std::chrono::steady_clock::time_point tEnd = std::chrono::steady_clock::now();
+
+      oResult.m_vecMicros.push_back(std::chrono::duration<double, std::micro>(tEnd - tStart).count());
+    }
+
+    fprintf(stderr, "%-12s %-16s %-28s threads: %-3lu %14.1f us\n", pcGroup, strTest.c_str(), pcImpl, (unsigned long) nThreads,
+            *std::min_element(oResult.m_vecMicros.begin(), oResult.m_vecMicros.end()));
+
+    m_vecResults.push_back(oResult);
+  }
+
+  template <class Run>
+  void run(const char* pcGroup, const std::string& strTest, const char* pcImpl, size_t nSize, Run fnRun)
+  {
+    run(pcGroup, strTest, pcImpl, nSize, 1, noPrepare, fnRun);
+  }
+
+  void write(FILE* pFile) const
+  {
+    size_t i;
+    size_t j;
+
+    fprintf(pFile, "{\n  \"benchmark\": \"mdz_ansi\",\n  \"repeat\": %lu,\n  \"results\": [\n", (unsigned long) m_oOptions.m_nRepeat);
+
+    for (i = 0; i < m_vecResults.size(); ++i)
+    {
+      const Result& oResult = m_vecResults[i];
+      std::vector<double> vecSorted(oResult.m_vecMicros);
+
+      std::sort(vecSorted.begin(), vecSorted.end());
+
+      fprintf(pFile, "    {\"group\": \"%s\", \"test\": \"%s\", \"impl\": \"%s\", \"size\": %lu, \"threads\": %lu, \"min_us\": %.1f, \"median_us\": %.1f, \"result\": %lu, \"samples_us\": [",
+              oResult.m_strGroup.c_str(), oResult.m_strTest.c_str(), oResult.m_strImpl.c_str(), (unsigned long) oResult.m_nSize, (unsigned long) oResult.m_nThreads,
+              vecSorted.front(), vecSorted[vecSorted.size() / 2], (unsigned long) oResult.m_nValue);
+
+      for (j = 0; j < oResult.m_vecMicros.size(); ++j)
+      {
+        fprintf(pFile, "%s%.1f", (j > 0) ? ", " : "", oResult.m_vecMicros[j]);
+      }
+
+      fprintf(pFile, "]}%s\n", (i + 1 < m_vecResults.size()) ? "," : "");
+    }
+
+    fprintf(pFile, "  ]\n}\n");
+  }
+
+  const Options& options() const
+  {
+    return m_oOptions;
+  }
+
+private:
+  static void noPrepare()
+  {
+  }
+
+  const Options& m_oOptions;
+  std::vector<Result> m_vecResults;
+};
+
+struct FindMethod
+{
+  enum mdz_find_method m_enMethod;
+  const char* m_pcName;
+  const char* m_pcReverseName;
+  bool m_bQuadratic;
+};
+
+const FindMethod g_aFindMethods[] =
+{
+  { MDZ_FIND_MONOTONE, "mdz_ansi, monotone", "mdz_ansi rfind, monotone", false },
+  { MDZ_FIND_CLIB, "mdz_ansi, clib", "mdz_ansi rfind, clib", true },
+  { MDZ_FIND_BRUTE, "mdz_ansi, brute", "mdz_ansi rfind, brute", true },
+  { MDZ_FIND_BMH, "mdz_ansi, bmh", "mdz_ansi rfind, bmh", false }
+};
+
+/**
+ * README.md "find" tests: monotone strings, '1's with '2' on the last position of both strings
+ */
+void benchFind(Bench& oBench, size_t nSize)
+{
+  const bool bAll = oBench.options().m_bAll;
+  std::vector<std::pair<size_t, size_t> > vecCases;
+  size_t i;
+  size_t j;
+
+  vecCases.push_back(std::make_pair(1, nSize));
+  vecCases.push_back(std::make_pair(5, nSize));
+  vecCases.push_back(std::make_pair(10, nSize));
+  vecCases.push_back(std::make_pair(100, nSize));
+  vecCases.push_back(std::make_pair(1024, nSize));
+  vecCases.push_back(std::make_pair(nSize / 200, nSize / 100));
+  vecCases.push_back(std::make_pair(nSize - 100, nSize));
+  vecCases.push_back(std::make_pair(nSize, nSize));
+
+  for (i = 0; i < vecCases.size(); ++i)
+  {
+    const size_t nCount = vecCases[i].first;
+    const size_t nHaystack = vecCases[i].second;
+    const bool bLong = nCount > 100 && nCount < nHaystack;
+    std::string strTest;
+
+    if (0 == nCount || nCount > nHaystack)
+    {
+      continue;
+    }
+
+    strTest = (nSize - 100 == nCount) ? sizeLabel(nSize) + "-100/" + sizeLabel(nHaystack) : sizeLabel(nCount) + "/" + sizeLabel(nHaystack);
+
+    struct mdz_Ansi* pAnsi = createAnsi(nHaystack, '1', '2', false);
+    std::string strAnsi(pAnsi->m_pData, nHaystack);
+    std::string strItems(nCount - 1, '1');
+    strItems += '2';
+    const char* pcItems = strItems.c_str();
+
+    if (oBench.enabled("find"))
+    {
+      if (1 == nCount)
+      {
+        oBench.run("find", strTest, "mdz_ansi, single", nHaystack, [&]() { return mdz_ansi_findSingle(pAnsi, 0, nHaystack - 1, '2'); });
+        oBench.run("find", strTest, "memchr()", nHaystack, [&]() { return (size_t) ((const char*) memchr(pAnsi->m_pData, '2', nHaystack) - pAnsi->m_pData); });
+      }
+
+      for (j = 0; j < sizeof(g_aFindMethods) / sizeof(g_aFindMethods[0]); ++j)
+      {
+        const FindMethod& oMethod = g_aFindMethods[j];
+
+        if (bAll || !bLong || !oMethod.m_bQuadratic)
+        {
+          oBench.run("find", strTest, oMethod.m_pcName, nHaystack, [&]() { return mdz_ansi_find(pAnsi, 0, nHaystack - 1, pcItems, nCount, oMethod.m_enMethod); });
+        }
+      }
+
+      oBench.run("find", strTest, "mdz_ansi_ext, findFast", nHaystack, [&]() { return mdz_ansi_findFast(pAnsi, 0, nHaystack - 1, pcItems, nCount); });
+
+      if (bAll || !bLong)
+      {
+        oBench.run("find", strTest, "std::string.find()", nHaystack, [&]() { return (size_t) strAnsi.find(strItems); });
+        oBench.run("find", strTest, "clib (strstr())", nHaystack, [&]() { return (size_t) (strstr(pAnsi->m_pData, pcItems) - pAnsi->m_pData); });
+      }
+    }
+
+    mdz_ansi_destroy(&pAnsi);
+
+    /* mirrored data for reverse search: '2' on the first position of both strings */
+    if (oBench.enabled("rfind"))
+    {
+      pAnsi = createAnsi(nHaystack, '1', '2', true);
+      strAnsi.assign(pAnsi->m_pData, nHaystack);
+      std::reverse(strItems.begin(), strItems.end());
+      pcItems = strItems.c_str();
+
+      if (1 == nCount)
+      {
+        oBench.run("rfind", strTest, "mdz_ansi, single", nHaystack, [&]() { return mdz_ansi_rfindSingle(pAnsi, 0, nHaystack - 1, '2'); });
+        oBench.run("rfind", strTest, "mdz_ansi_ext, rfindSingleFast", nHaystack, [&]() { return mdz_ansi_rfindSingleFast(pAnsi, 0, nHaystack - 1, '2'); });
+      }
+
+      for (j = 0; j < sizeof(g_aFindMethods) / sizeof(g_aFindMethods[0]); ++j)
+      {
+        const FindMethod& oMethod = g_aFindMethods[j];
+
+        if (bAll || !bLong || !oMethod.m_bQuadratic)
+        {
+          oBench.run("rfind", strTest, oMethod.m_pcReverseName, nHaystack, [&]() { return mdz_ansi_rfind(pAnsi, 0, nHaystack - 1, pcItems, nCount, oMethod.m_enMethod); });
+        }
+      }
+
+      oBench.run("rfind", strTest, "mdz_ansi_ext, rfindFast", nHaystack, [&]() { return mdz_ansi_rfindFast(pAnsi, 0, nHaystack - 1, pcItems, nCount); });
+
+      if (bAll || !bLong)
+      {
+        oBench.run("rfind", strTest, "std::string.rfind()", nHaystack, [&]() { return (size_t) strAnsi.rfind(strItems); });
+      }
+
+      mdz_ansi_destroy(&pAnsi);
+    }
+  }
+}
+
+/**
+ * README.md "firstOf" tests: find first of 1..100 items, one of them is on the last position of string
+ */
+void benchFirstOf(Bench& oBench, size_t nSize)
+{
+  static const size_t aCounts[] = { 1, 5, 20, 50, 100 };
+  size_t i;
+  size_t j;
+
+  if (!oBench.enabled("firstOf"))
+  {
+    return;
+  }
+
+  for (i = 0; i < sizeof(aCounts) / sizeof(aCounts[0]); ++i)
+  {
+    const size_t nCount = aCounts[i];
+    std::string strItems;
+
+    for (j = 0; j < nCount; ++j)
+    {
+      strItems += (char) (0x80 + j);
+    }
+
+    struct mdz_Ansi* pAnsi = createAnsi(nSize, '1', strItems[nCount - 1], false);
+    std::string strAnsi(pAnsi->m_pData, nSize);
+    const char* pcItems = strItems.c_str();
+    const std::string strTest = sizeLabel(nCount) + "/" + sizeLabel(nSize);
+
+    oBench.run("firstOf", strTest, "mdz_ansi", nSize, [&]() { return mdz_ansi_firstOf(pAnsi, 0, nSize - 1, pcItems, nCount); });
+    oBench.run("firstOf", strTest, "std::string.find_first_of()", nSize, [&]() { return (size_t) strAnsi.find_first_of(strItems); });
+    oBench.run("firstOf", strTest, "clib (strcspn())", nSize, [&]() { return strcspn(pAnsi->m_pData, pcItems); });
+
+    if (1 == nCount)
+    {
+      oBench.run("firstOf", strTest, "memchr()", nSize, [&]() { return (size_t) ((const char*) memchr(pAnsi->m_pData, pcItems[0], nSize) - pAnsi->m_pData); });
+    }
+
+    mdz_ansi_destroy(&pAnsi);
+  }
+}
+
+/**
+ * Modifying workloads. Input data is restored before every measurement
+ */
+void benchModify(Bench& oBench, size_t nSize)
+{
+  const std::string strTest = sizeLabel(nSize);
+  std::string strSource(nSize, 'a');
+  std::string strData;
+  struct mdz_Ansi* pAnsi = mdz_ansi_create(0);
+  struct mdz_Ansi* pSubAnsi = mdz_ansi_create(0);
+  size_t i;
+  size_t j;
+
+  /* "abc" on every 64th position */
+  for (i = 0; i + 3 <= nSize; i += 64)
+  {
+    strSource[i + 1] = 'b';
+    strSource[i + 2] = 'c';
+  }
+
+  auto fnResetAnsi = [&]() { mdz_ansi_clear(pAnsi); mdz_ansi_insert(pAnsi, 0, strSource.data(), nSize, mdz_true); };
+  auto fnResetString = [&]() { strData = strSource; };
+
+  if (oBench.enabled("insert"))
+  {
+    auto fnClearAnsi = [&]() { mdz_ansi_clear(pAnsi); };
+    auto fnClearString = [&]() { strData.clear(); strData.shrink_to_fit(); };
+
+    oBench.run("insert", strTest, "mdz_ansi", nSize, 1, fnClearAnsi, [&]() { mdz_ansi_insert(pAnsi, 0, strSource.data(), nSize, mdz_true); return mdz_ansi_size(pAnsi); });
+    oBench.run("insert", strTest, "std::string.append()", nSize, 1, fnClearString, [&]() { strData.append(strSource); return strData.size(); });
+    oBench.run("insert", strTest + " (front, 1K)", "mdz_ansi", nSize, 1, fnResetAnsi, [&]() { mdz_ansi_insert(pAnsi, 0, strSource.data(), 1024, mdz_true); return mdz_ansi_size(pAnsi); });
+    oBench.run("insert", strTest + " (front, 1K)", "std::string.insert()", nSize, 1, fnResetString, [&]() { strData.insert(0, strSource, 0, 1024); return strData.size(); });
+  }
+
+  if (oBench.enabled("replace"))
+  {
+    oBench.run("replace", strTest, "mdz_ansi", nSize, 1, fnResetAnsi, [&]() { mdz_ansi_replace(pAnsi, 0, SIZE_MAX, "abc", 3, "xy", 2, mdz_true); return mdz_ansi_size(pAnsi); });
+    oBench.run("replace", strTest, "std::string", nSize, 1, fnResetString, [&]()
+    {
+      std::string strOut;
+      size_t nFrom = 0;
+      size_t nFound;
+
+      strOut.reserve(strData.size());
+      while ((nFound = strData.find("abc", nFrom)) != std::string::npos)
+      {
+        strOut.append(strData, nFrom, nFound - nFrom);
+        strOut.append("xy");
+        nFrom = nFound + 3;
+      }
+      strOut.append(strData, nFrom, std::string::npos);
+      strData.swap(strOut);
+      return strData.size();
+    });
+  }
+
+  if (oBench.enabled("count"))
+  {
+    fnResetAnsi();
+    fnResetString();
+
+    for (j = 0; j < sizeof(g_aFindMethods) / sizeof(g_aFindMethods[0]); ++j)
+    {
+      const FindMethod& oMethod = g_aFindMethods[j];
+      oBench.run("count", strTest, oMethod.m_pcName, nSize, [&]() { return mdz_ansi_count(pAnsi, 0, SIZE_MAX, "abc", 3, oMethod.m_enMethod, mdz_false); });
+    }
+
+    oBench.run("count", strTest, "std::string.find()", nSize, [&]()
+    {
+      size_t nCount = 0;
+      size_t nFound = 0;
+
+      while ((nFound = strData.find("abc", nFound)) != std::string::npos)
+      {
+        ++nCount;
+        nFound += 3;
+      }
+      return nCount;
+    });
+  }
+
+  if (oBench.enabled("trim"))
+  {
+    /* a quarter of spaces from left and from right */
+    std::string strPadded(nSize, ' ');
+    strPadded.replace(nSize / 4, nSize / 2, nSize / 2, 'a');
+
+    auto fnResetPaddedAnsi = [&]() { mdz_ansi_clear(pAnsi); mdz_ansi_insert(pAnsi, 0, strPadded.data(), nSize, mdz_true); };
+    auto fnResetPaddedString = [&]() { strData = strPadded; };
+
+    oBench.run("trim", strTest, "mdz_ansi", nSize, 1, fnResetPaddedAnsi, [&]() { mdz_ansi_trim(pAnsi, 0, SIZE_MAX, " ", 1); return mdz_ansi_size(pAnsi); });
+    oBench.run("trim", strTest, "mdz_ansi_ext, trimFast", nSize, 1, fnResetPaddedAnsi, [&]() { mdz_ansi_trimFast(pAnsi, 0, SIZE_MAX, " ", 1); return mdz_ansi_size(pAnsi); });
+    oBench.run("trim", strTest, "std::string", nSize, 1, fnResetPaddedString, [&]()
+    {
+      strData.erase(strData.find_last_not_of(' ') + 1);
+      strData.erase(0, strData.find_first_not_of(' '));
+      return strData.size();
+    });
+  }
+
+  if (oBench.enabled("copySubAnsi"))
+  {
+    fnResetAnsi();
+    fnResetString();
+    pAnsi->m_pData[nSize - 1] = '\n';
+    strData[nSize - 1] = '\n';
+
+    oBench.run("copySubAnsi", strTest, "mdz_ansi", nSize, [&]() { return mdz_ansi_copySubAnsi(pAnsi, 0, SIZE_MAX, "\r\n", 2, pSubAnsi); });
+    oBench.run("copySubAnsi", strTest, "std::string.substr()", nSize, [&]()
+    {
+      std::string strSub = strData.substr(0, strData.find_first_of("\r\n"));
+      return strSub.size() + 1;
+    });
+  }
+
+  mdz_ansi_destroy(&pSubAnsi);
+  mdz_ansi_destroy(&pAnsi);
+}
+
+/**
+ * nThreads concurrent asynchronous calls, every call processes its own string
+ */
+void benchAsync(Bench& oBench, size_t nSize)
+{
+  const std::vector<size_t>& vecThreads = oBench.options().m_vecThreads;
+  const std::string strTest = "100/" + sizeLabel(nSize);
+  std::string strItems(99, '1');
+  size_t i;
+
+  if (!oBench.enabled("async"))
+  {
+    return;
+  }
+
+  strItems += '2';
+
+  for (i = 0; i < vecThreads.size(); ++i)
+  {
+    const size_t nThreads = vecThreads[i];
+    std::vector<struct mdz_Ansi*> vecAnsi(nThreads);
+    std::vector<struct mdz_asyncData> vecAsync(nThreads);
+    size_t j;
+
+    for (j = 0; j < nThreads; ++j)
+    {
+      vecAnsi[j] = createAnsi(nSize, '1', '2', false);
+    }
+
+    auto fnReset = [&]() { memset(vecAsync.data(), 0, nThreads * sizeof(struct mdz_asyncData)); };
+
+    oBench.run("async", strTest, "mdz_ansi_find_async, bmh", nSize, nThreads, fnReset, [&]()
+    {
+      size_t k;
+      size_t nFound = 0;
+
+      for (k = 0; k < nThreads; ++k)
+      {
+        mdz_ansi_find_async(vecAnsi[k], 0, nSize - 1, strItems.c_str(), strItems.size(), MDZ_FIND_BMH, &vecAsync[k]);
+      }
+      for (k = 0; k < nThreads; ++k)
+      {
+        waitAsync(&vecAsync[k]);
+        nFound = vecAsync[k].m_nResult;
+      }
+      return nFound;
+    });
+
+    oBench.run("async", strTest, "mdz_ansi_findFast_async", nSize, nThreads, fnReset, [&]()
+    {
+      size_t k;
+      size_t nFound = 0;
+
+      for (k = 0; k < nThreads; ++k)
+      {
+        mdz_ansi_findFast_async(vecAnsi[k], 0, nSize - 1, strItems.c_str(), strItems.size(), &vecAsync[k]);
+      }
+      for (k = 0; k < nThreads; ++k)
+      {
+        waitAsync(&vecAsync[k]);
+        nFound = vecAsync[k].m_nResult;
+      }
+      return nFound;
+    });
+
+    for (j = 0; j < nThreads; ++j)
+    {
+      mdz_ansi_destroy(&vecAnsi[j]);
+    }
+  }
+}
+
+/**
+ * Overhead of call statistics: the same findFast calls with statistics disabled, enabled, and enabled with timing, many short calls (where overhead is most visible) and one long call.
+ * Needs "ext" sources compiled with MDZ_ANSI_EXT_STATS
+ */
+void benchStats(Bench& oBench, size_t nSize)
+{
+  static const char* const aImpls[] = { "findFast, stats disabled", "findFast, stats enabled", "findFast, stats timed" };
+  const size_t nCalls = 10000;
+  const size_t nShort = 64;
+  const std::string strShortTest = sizeLabel(nCalls) + " x " + sizeLabel(nShort);
+  const std::string strLongTest = sizeLabel(nSize);
+  size_t i;
+
+  if (!oBench.enabled("stats"))
+  {
+    return;
+  }
+
+  if (!mdz_ansi_statsEnable(mdz_false))
+  {
+    fprintf(stderr, "\"stats\" workloads need mdz_ansi_ext compiled with MDZ_ANSI_EXT_STATS\n");
+    return;
+  }
+
+  struct mdz_Ansi* pShort = createAnsi(nShort, '1', '2', false);
+  struct mdz_Ansi* pLong = createAnsi(nSize, '1', '2', false);
+
+  for (i = 0; i < 3; ++i)
+  {
+    mdz_ansi_statsEnable((i > 0) ? mdz_true : mdz_false);
+    mdz_ansi_statsEnableTiming((2 == i) ? mdz_true : mdz_false);
+
+    oBench.run("stats", strShortTest, aImpls[i], nShort * nCalls, [&]()
+    {
+      size_t k;
+      size_t nFound = 0;
+
+      for (k = 0; k < nCalls; ++k)
+      {
+        nFound += mdz_ansi_findFast(pShort, 0, nShort - 1, "12", 2);
+      }
+      return nFound;
+    });
+
+    oBench.run("stats", strLongTest, aImpls[i], nSize, [&]() { return mdz_ansi_findFast(pLong, 0, nSize - 1, "12", 2); });
+  }
+
+  mdz_ansi_statsEnable(mdz_false);
+  mdz_ansi_statsEnableTiming(mdz_false);
+
+  mdz_ansi_destroy(&pLong);
+  mdz_ansi_destroy(&pShort);
+}
+
+void usage()
+{
+  fprintf(stderr, "usage: mdz_ansi_bench --license <file> [--sizes 1M,100M] [--threads 1,2,4] [--repeat 3] [--filter <group>] [--all] [--out <file>]\n");
+}
+
+} /* namespace */
+
+int main(int argc, char* argv[])
+{
+  Options oOptions;
+  FILE* pFile = stdout;
+  int i;
+  size_t j;
+
+  oOptions.m_vecSizes.push_back(100 * 1024 * 1024);
+  oOptions.m_vecThreads.push_back(1);
+  oOptions.m_vecThreads.push_back(2);
+  oOptions.m_vecThreads.push_back(4);
+
+  for (i = 1; i < argc; ++i)
+  {
+    const std::string strArg = argv[i];
+    const char* pcValue = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+    if ("--all" == strArg)
+    {
+      oOptions.m_bAll = true;
+      continue;
+    }
+
+    if (NULL == pcValue)
+    {
+      usage();
+      return 1;
+    }
+
+    if ("--license" == strArg)
+    {
+      oOptions.m_strLicense = pcValue;
+    }
+    else if ("--sizes" == strArg && parseList(pcValue, oOptions.m_vecSizes))
+    {
+    }
+    else if ("--threads" == strArg && parseList(pcValue, oOptions.m_vecThreads))
+    {
+    }
+    else if ("--repeat" == strArg && parseSize(pcValue, oOptions.m_nRepeat))
+    {
+    }
+    else if ("--filter" == strArg)
+    {
+      oOptions.m_strFilter = pcValue;
+    }
+    else if ("--out" == strArg)
+    {
+      oOptions.m_strOut = pcValue;
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+    ++i;
+  }
+
+  if (oOptions.m_strLicense.empty())
+  {
+    usage();
+    return 1;
+  }
+
+  if (!initLibrary(oOptions.m_strLicense))
+  {
+    fprintf(stderr, "mdz_ansi_init() failed\n");
+    return 1;
+  }
+
+  Bench oBench(oOptions);
+
+  for (j = 0; j < oOptions.m_vecSizes.size(); ++j)
+  {
+    benchFind(oBench, oOptions.m_vecSizes[j]);
+    benchFirstOf(oBench, oOptions.m_vecSizes[j]);
+    benchModify(oBench, oOptions.m_vecSizes[j]);
+    benchAsync(oBench, oOptions.m_vecSizes[j]);
+    benchStats(oBench, oOptions.m_vecSizes[j]);
+  }
+
+  if (!oOptions.m_strOut.empty())
+  {
+    pFile = fopen(oOptions.m_strOut.c_str(), "w");
+    if (NULL == pFile)
+    {
+      fprintf(stderr, "cannot open \"%s\"\n", oOptions.m_strOut.c_str());
+      return 1;
+    }
+  }
+
+  oBench.write(pFile);
+
+  if (pFile != stdout)
+  {
+    fclose(pFile);
+  }
+
+  mdz_ansi_uninit();
+  return 0;
+}
@@ -0,0 +1,859 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Self-checking program for mdz_ansi_ext functions. Results of functions are compared with reference implementations (C library functions or naive loops)
+ * on edge cases and on random inputs. Mismatches are written to standard error, program exits with code 1 if there are any.
+ *
+ * Build (Linux, from repository root):
+ *   g++ -O2 -std=c++11 -I. -Iext bench/mdz_ansi_check.cpp ext/mdz_ansi_ext_*.c -o mdz_ansi_check -LLinux/x64 -lmdz_ansi -lpthread
+ * Build (Windows, Visual Studio command prompt, from repository root):
+ *   cl /O2 /EHsc /I. /Iext bench\mdz_ansi_check.cpp ext\mdz_ansi_ext_*.c Win64\v140-shared\mdz_ansi.lib
+ *
+ * Usage:
+ *   mdz_ansi_check --license <file> [--count 100000] [--seed 1] [--filter number]
+ *
+ * License file is the same as for mdz_ansi_bench (see "bench/mdz_ansi_bench.cpp").
+ * --count  - number of random inputs of every check. Default is 100000
+ * --seed   - seed of random inputs. Default is 1
+ * --filter - run only checks which group name contains given text
+ *
+ */
+
+#include "mdz_ansi.h"
+#include "mdz_ansi_ext.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Options
+{
+  size_t m_nCount;
+  unsigned long m_nSeed;
+  std::string m_strFilter;
+  std::string m_strLicense;
+
+  Options() : m_nCount(100000), m_nSeed(1)
+  {
+  }
+};
+
+bool initLibrary(const std::string& strLicense)
+{
+  std::ifstream oFile(strLicense.c_str());
+  std::vector<uint32_t> vecHashes[4];
+  std::string strLine;
+  size_t i;
+
+  for (i = 0; i < 4 && std::getline(oFile, strLine); ++i)
+  {
+    std::replace(strLine.begin(), strLine.end(), ',', ' ');
+    std::istringstream iss(strLine);
+    std::string strHash;
+
+    while (iss >> strHash)
+    {
+      vecHashes[i].push_back((uint32_t) strtoul(strHash.c_str(), NULL, 0));
+    }
+  }
+
+  if (i < 4)
+  {
+    fprintf(stderr, "license file \"%s\" should contain 4 lines with hash codes\n", strLicense.c_str());
+    return false;
+  }
+
+  return mdz_true == mdz_ansi_init(vecHashes[0].data(), vecHashes[1].data(), vecHashes[2].data(), vecHashes[3].data());
+}
+
+/**
+ * Replace content of pAnsi with strText
+ */
+void setText(struct mdz_Ansi* pAnsi, const std::string& strText)
+{
+  mdz_ansi_clear(pAnsi);
+
+  if (!strText.empty() && !mdz_ansi_insert(pAnsi, 0, strText.data(), strText.size(), mdz_true))
+  {
+    fprintf(stderr, "cannot insert %lu items\n", (unsigned long) strText.size());
+    exit(1);
+  }
+}
+
+std::string getText(const struct mdz_Ansi* pAnsi)
+{
+  return std::string(pAnsi->m_pData, mdz_ansi_size(pAnsi));
+}
+
+/**
+ * Bit pattern of double: parsed values are compared exactly (also sign of 0)
+ */
+uint64_t doubleBits(double dValue)
+{
+  uint64_t nBits;
+  memcpy(&nBits, &dValue, sizeof(nBits));
+  return nBits;
+}
+
+double bitsDouble(uint64_t nBits)
+{
+  double dValue;
+  memcpy(&dValue, &nBits, sizeof(dValue));
+  return dValue;
+}
+
+/**
+ * Counts checks and mismatches of group. First mismatches of every group are reported
+ */
+class Check
+{
+public:
+  explicit Check(const Options& oOptions) : m_oOptions(oOptions), m_oRandom(oOptions.m_nSeed), m_nChecks(0), m_nFailures(0), m_nGroupFailures(0)
+  {
+  }
+
+  bool begin(const char* pcGroup)
+  {
+    if (std::string(pcGroup).find(m_oOptions.m_strFilter) == std::string::npos)
+    {
+      return false;
+    }
+
+    m_strGroup = pcGroup;
+    m_nGroupFailures = 0;
+    m_nGroupStart = m_nChecks;
+    return true;
+  }
+
+  void end()
+  {
+    printf("%-10s %10lu checks, %lu failures\n", m_strGroup.c_str(), (unsigned long) (m_nChecks - m_nGroupStart), (unsigned long) m_nGroupFailures);
+  }
+
+  /**
+   * Count check. If bPassed is false, mismatch is reported with strInput and printf-like description of difference
+   */
+  bool expect(bool bPassed, const std::string& strInput, const char* pcFormat, ...)
+  {
+    ++m_nChecks;
+
+    if (bPassed)
+    {
+      return true;
+    }
+
+    ++m_nFailures;
+    if (++m_nGroupFailures <= 10)
+    {
+      va_list args;
+      va_start(args, pcFormat);
+      fprintf(stderr, "%s: \"%s\": ", m_strGroup.c_str(), (strInput.size() > 80) ? (strInput.substr(0, 77) + "...").c_str() : strInput.c_str());
+      vfprintf(stderr, pcFormat, args);
+      fprintf(stderr, "\n");
+      va_end(args);
+    }
+    return false;
+  }
+
+  size_t count() const
+  {
+    return m_oOptions.m_nCount;
+  }
+
+  std::mt19937_64& random()
+  {
+    return m_oRandom;
+  }
+
+  size_t failures() const
+  {
+    return m_nFailures;
+  }
+
+private:
+  const Options& m_oOptions;
+  std::mt19937_64 m_oRandom;
+  std::string m_strGroup;
+  size_t m_nChecks;
+  size_t m_nGroupStart;
+  size_t m_nFailures;
+  size_t m_nGroupFailures;
+};
+
+/**
+ * mdz_ansi_parseInt64 and mdz_ansi_parseUint64 against strtoll()/strtoull(): powers of 10 and their neighbours (crossing 8- and 16-digit blocks), limits of int64_t/uint64_t
+ * and values just above them, leading zeros, random values. Also appendInt64/appendUint64 against snprintf() and parsing back
+ */
+void checkInt(Check& oCheck)
+{
+  static const char* const aOverflows[] = { "9223372036854775808", "-9223372036854775809", "99999999999999999999", "-99999999999999999999", "123456789012345678901234567890" };
+  static const char* const aUnsignedOverflows[] = { "18446744073709551616", "99999999999999999999", "184467440737095516150" };
+  struct mdz_Ansi* pAnsi = mdz_ansi_create(0);
+  std::vector<std::string> vecInputs;
+  char acBuffer[64];
+  int64_t nValue;
+  uint64_t nUnsigned;
+  uint64_t nPower;
+  size_t nEndPos;
+  size_t i;
+  int j;
+  bool bParsed;
+
+  if (!oCheck.begin("int"))
+  {
+    mdz_ansi_destroy(&pAnsi);
+    return;
+  }
+
+  for (nPower = 1, j = 0; j < 20; ++j, nPower *= 10)
+  {
+    const uint64_t aValues[] = { nPower - 1, nPower, nPower + 1 };
+
+    for (i = 0; i < 3; ++i)
+    {
+      snprintf(acBuffer, sizeof(acBuffer), "%" PRIu64, aValues[i]);
+      vecInputs.push_back(acBuffer);
+      vecInputs.push_back(std::string("-") + acBuffer);
+      vecInputs.push_back(std::string("+") + acBuffer);
+      vecInputs.push_back(std::string("0000000000000000000000000") + acBuffer);
+    }
+  }
+
+  vecInputs.push_back("9223372036854775807");
+  vecInputs.push_back("-9223372036854775808");
+  vecInputs.push_back("18446744073709551615");
+
+  for (i = 0; i < oCheck.count(); ++i)
+  {
+    /* random value of random number of digits */
+    nUnsigned = oCheck.random()() >> (oCheck.random()() % 64);
+    snprintf(acBuffer, sizeof(acBuffer), "%s%" PRIu64, (nUnsigned & 1) ? "-" : "", nUnsigned);
+    vecInputs.push_back(acBuffer);
+  }
+
+  for (i = 0; i < vecInputs.size(); ++i)
+  {
+    const std::string& strInput = vecInputs[i];
+    const bool bNegative = ('-' == strInput[0]);
+    long long nReference;
+    unsigned long long nUnsignedReference;
+
+    setText(pAnsi, strInput);
+
+    errno = 0;
+    nReference = strtoll(strInput.c_str(), NULL, 10);
+    bParsed = (mdz_true == mdz_ansi_parseInt64(pAnsi, 0, SIZE_MAX, &nValue, &nEndPos));
+    oCheck.expect(bParsed == (0 == errno) && nValue == (int64_t) nReference && nEndPos == strInput.size(), strInput,
+      "parseInt64 %d %" PRId64 " end %lu, strtoll %" PRId64, (int) bParsed, nValue, (unsigned long) nEndPos, (int64_t) nReference);
+
+    if (!bNegative)
+    {
+      errno = 0;
+      nUnsignedReference = strtoull(strInput.c_str(), NULL, 10);
+      bParsed = (mdz_true == mdz_ansi_parseUint64(pAnsi, 0, SIZE_MAX, &nUnsigned, &nEndPos));
+      oCheck.expect(bParsed == (0 == errno) && nUnsigned == (uint64_t) nUnsignedReference && nEndPos == strInput.size(), strInput,
+        "parseUint64 %d %" PRIu64 " end %lu, strtoull %" PRIu64, (int) bParsed, nUnsigned, (unsigned long) nEndPos, (uint64_t) nUnsignedReference);
+    }
+  }
+
+  for (i = 0; i < sizeof(aOverflows) / sizeof(aOverflows[0]); ++i)
+  {
+    setText(pAnsi, aOverflows[i]);
+    bParsed = mdz_ansi_parseInt64(pAnsi, 0, SIZE_MAX, &nValue, &nEndPos);
+    oCheck.expect(!bParsed && nValue == (('-' == aOverflows[i][0]) ? INT64_MIN : INT64_MAX) && nEndPos == strlen(aOverflows[i]) && MDZ_ERROR_CONTENT == pAnsi->m_enErrorCode, aOverflows[i],
+      "parseInt64 overflow %d %" PRId64 " end %lu", (int) bParsed, nValue, (unsigned long) nEndPos);
+  }
+
+  for (i = 0; i < sizeof(aUnsignedOverflows) / sizeof(aUnsignedOverflows[0]); ++i)
+  {
+    setText(pAnsi, aUnsignedOverflows[i]);
+    bParsed = mdz_ansi_parseUint64(pAnsi, 0, SIZE_MAX, &nUnsigned, &nEndPos);
+    oCheck.expect(!bParsed && UINT64_MAX == nUnsigned && nEndPos == strlen(aUnsignedOverflows[i]) && MDZ_ERROR_CONTENT == pAnsi->m_enErrorCode, aUnsignedOverflows[i],
+      "parseUint64 overflow %d %" PRIu64 " end %lu", (int) bParsed, nUnsigned, (unsigned long) nEndPos);
+  }
+
+  /* format -> parse */
+  for (i = 0; i < oCheck.count(); ++i)
+  {
+    nValue = (int64_t) (oCheck.random()() >> (1 + oCheck.random()() % 63));
+    nValue = (i & 1) ? -nValue : nValue;
+    nValue = (0 == i) ? INT64_MIN : (1 == i) ? INT64_MAX : nValue;
+    snprintf(acBuffer, sizeof(acBuffer), "%" PRId64, nValue);
+
+    mdz_ansi_clear(pAnsi);
+    mdz_ansi_appendInt64(pAnsi, nValue);
+    oCheck.expect(getText(pAnsi) == acBuffer && mdz_ansi_parseInt64(pAnsi, 0, SIZE_MAX, &nValue, NULL) && strtoll(acBuffer, NULL, 10) == nValue, acBuffer,
+      "appendInt64 \"%s\", parsed back %" PRId64, getText(pAnsi).c_str(), nValue);
+
+    nUnsigned = (0 == i) ? UINT64_MAX : oCheck.random()() >> (oCheck.random()() % 64);
+    snprintf(acBuffer, sizeof(acBuffer), "%" PRIu64, nUnsigned);
+
+    mdz_ansi_clear(pAnsi);
+    mdz_ansi_appendUint64(pAnsi, nUnsigned);
+    oCheck.expect(getText(pAnsi) == acBuffer && mdz_ansi_parseUint64(pAnsi, 0, SIZE_MAX, &nUnsigned, NULL) && strtoull(acBuffer, NULL, 10) == nUnsigned, acBuffer,
+      "appendUint64 \"%s\", parsed back %" PRIu64, getText(pAnsi).c_str(), nUnsigned);
+  }
+
+  oCheck.end();
+  mdz_ansi_destroy(&pAnsi);
+}
+
+/**
+ * Compare mdz_ansi_parseDouble of strInput with strtod() bit-exactly
+ */
+void expectDouble(Check& oCheck, struct mdz_Ansi* pAnsi, const std::string& strInput)
+{
+  double dValue = -1;
+  size_t nEndPos = 0;
+  char* pcEnd;
+  const double dReference = strtod(strInput.c_str(), &pcEnd);
+  const bool bParsed = (mdz_true == mdz_ansi_parseDouble(pAnsi, 0, SIZE_MAX, &dValue, &nEndPos));
+
+  oCheck.expect(bParsed && (doubleBits(dValue) == doubleBits(dReference) || (std::isnan(dValue) && std::isnan(dReference))) && nEndPos == (size_t) (pcEnd - strInput.c_str()), strInput,
+    "parseDouble %d %.17g end %lu, strtod %.17g end %lu", (int) bParsed, dValue, (unsigned long) nEndPos, dReference, (unsigned long) (pcEnd - strInput.c_str()));
+}
+
+/**
+ * mdz_ansi_parseDouble against strtod(): halfway cases (exact midpoints between neighbouring doubles, which round to even, and midpoints followed by non-zero digit far
+ * behind, which round up), limits of double, subnormals, special values, random digits with random exponents. Also appendDouble -> parseDouble round-trip of random doubles
+ */
+void checkDouble(Check& oCheck)
+{
+  static const char* const aInputs[] = { "0", "-0", "0.0", ".5", "5.", "1e0", "1E+0", "1e-0", "1.7976931348623157e308", "1.7976931348623159e308", "1.8e308", "1e309",
+    "2.2250738585072014e-308", "2.2250738585072011e-308", "4.9406564584124654e-324", "2.4703282292062328e-324", "2.4703282292062327e-324", "1e-400",
+    "inf", "-Infinity", "nan", "NaN", "123456789012345678901234567890", "0.000000000000000000000000000001", "9007199254740993", "9007199254740993.0000000000000000000001",
+    "0.1", "0.2", "0.3", "1e23", "8.98846567431158e307", "4.35679719200000e-13" };
+  struct mdz_Ansi* pAnsi = mdz_ansi_create(0);
+  char acBuffer[64];
+  uint64_t nMantissa;
+  double dValue;
+  size_t nEndPos;
+  size_t i;
+  int nExponent;
+
+  if (!oCheck.begin("double"))
+  {
+    mdz_ansi_destroy(&pAnsi);
+    return;
+  }
+
+  for (i = 0; i < sizeof(aInputs) / sizeof(aInputs[0]); ++i)
+  {
+    setText(pAnsi, aInputs[i]);
+    expectDouble(oCheck, pAnsi, aInputs[i]);
+  }
+
+  for (i = 0; i < oCheck.count(); ++i)
+  {
+    /* between 2^54 and 2^64 spacing of doubles is 2^nExponent, thus odd multiples of 2^(nExponent-1) are exact ties (round to even). Ties are checked also followed
+       by "1" after many zeros (round up), and with random decimal exponent */
+    nExponent = 1 + (int) (oCheck.random()() % 11);
+    nMantissa = ((oCheck.random()() >> 11) | (UINT64_C(1) << 52)) << nExponent;
+    nMantissa |= UINT64_C(1) << (nExponent - 1);
+
+    snprintf(acBuffer, sizeof(acBuffer), "%" PRIu64, nMantissa);
+    setText(pAnsi, acBuffer);
+    expectDouble(oCheck, pAnsi, acBuffer);
+
+    snprintf(acBuffer, sizeof(acBuffer), "%" PRIu64 "e%d", nMantissa, (int) (oCheck.random()() % 40) - 20);
+    setText(pAnsi, acBuffer);
+    expectDouble(oCheck, pAnsi, acBuffer);
+
+    snprintf(acBuffer, sizeof(acBuffer), "%" PRIu64 ".00000000000000000001", nMantissa);
+    setText(pAnsi, acBuffer);
+    expectDouble(oCheck, pAnsi, acBuffer);
+
+    /* random digits (up to 19 and more than 19 significant digits) with random exponent */
+    snprintf(acBuffer, sizeof(acBuffer), "%" PRIu64 "%s%" PRIu64 "e%d", oCheck.random()() >> (oCheck.random()() % 64), (i & 1) ? "." : "",
+      (i & 2) ? oCheck.random()() : 0, (int) (oCheck.random()() % 700) - 350);
+    setText(pAnsi, acBuffer);
+    expectDouble(oCheck, pAnsi, acBuffer);
+  }
+
+  /* format -> parse: random bit patterns cover all exponents, including subnormals */
+  for (i = 0; i < oCheck.count(); ++i)
+  {
+    dValue = bitsDouble(oCheck.random()());
+    if (std::isnan(dValue))
+    {
+      continue;
+    }
+
+    snprintf(acBuffer, sizeof(acBuffer), "%.17g", dValue);
+
+    mdz_ansi_clear(pAnsi);
+    mdz_ansi_appendDouble(pAnsi, dValue);
+    const std::string strText = getText(pAnsi);
+    const double dReference = strtod(strText.c_str(), NULL);
+    double dParsed = 0;
+
+    oCheck.expect(mdz_ansi_parseDouble(pAnsi, 0, SIZE_MAX, &dParsed, &nEndPos) && nEndPos == strText.size() && doubleBits(dParsed) == doubleBits(dValue)
+      && doubleBits(dReference) == doubleBits(dValue), acBuffer, "appendDouble \"%s\", parsed back %.17g, strtod %.17g", strText.c_str(), dParsed, dReference);
+  }
+
+  oCheck.end();
+  mdz_ansi_destroy(&pAnsi);
+}
+
+/**
+ * Position of first occurrence of strItems in strText between nLeftPos and nRightPos (inclusive), or Size of strText if not found
+ */
+size_t naiveFind(const std::string& strText, size_t nLeftPos, size_t nRightPos, const std::string& strItems)
+{
+  size_t i;
+
+  for (i = nLeftPos; i + strItems.size() <= nRightPos + 1; ++i)
+  {
+    if (0 == memcmp(strText.data() + i, strItems.data(), strItems.size()))
+    {
+      return i;
+    }
+  }
+
+  return strText.size();
+}
+
+size_t naiveCount(const std::string& strText, size_t nLeftPos, size_t nRightPos, const std::string& strItems, bool bAllowOverlapped)
+{
+  size_t nFound = 0;
+  size_t i;
+
+  for (i = nLeftPos; i + strItems.size() <= nRightPos + 1; )
+  {
+    if (0 == memcmp(strText.data() + i, strItems.data(), strItems.size()))
+    {
+      ++nFound;
+      i += bAllowOverlapped ? 1 : strItems.size();
+    }
+    else
+    {
+      ++i;
+    }
+  }
+
+  return nFound;
+}
+
+/**
+ * mdz_ansi_compressedFind/Count/Copy against naive search and copying on compressible text with rare random bytes and long runs, with small (many borders) and default blocks.
+ * Searched items are sub-strings of text (also crossing borders of blocks), words, sub-strings with changed last byte and random bytes, in random ranges
+ */
+void checkCompressed(Check& oCheck)
+{
+  static const char* const aWords[] = { "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "error", "warning", "2021-03-05", "GET /index.html HTTP/1.1" };
+  static const size_t aBlockSizes[] = { 1024, 0 };
+  const size_t nWords = sizeof(aWords) / sizeof(aWords[0]);
+  const size_t nSize = 256 * 1024;
+  const size_t nQueries = std::max<size_t>(oCheck.count() / 50, 100);
+  struct mdz_Ansi* pAnsi = mdz_ansi_create(0);
+  struct mdz_Ansi* pCopy = mdz_ansi_create(0);
+  struct mdz_ansi_compressed* pCompressed;
+  std::string strText;
+  std::string strItems;
+  size_t nBlockSize;
+  size_t nLeftPos;
+  size_t nRightPos;
+  size_t nPos;
+  size_t nResult;
+  size_t nReference;
+  size_t i;
+  size_t j;
+  int k;
+
+  if (!oCheck.begin("compressed"))
+  {
+    mdz_ansi_destroy(&pCopy);
+    mdz_ansi_destroy(&pAnsi);
+    return;
+  }
+
+  while (strText.size() < nSize)
+  {
+    strText += aWords[oCheck.random()() % nWords];
+    strText += (0 == oCheck.random()() % 8) ? '\n' : ' ';
+
+    if (0 == oCheck.random()() % 64)
+    {
+      strText += (char) (1 + oCheck.random()() % 255);
+    }
+
+    if (0 == oCheck.random()() % 4096)
+    {
+      strText.append(1000 + oCheck.random()() % 5000, 'a');
+    }
+  }
+
+  setText(pAnsi, strText);
+
+  for (j = 0; j < sizeof(aBlockSizes) / sizeof(aBlockSizes[0]); ++j)
+  {
+    nBlockSize = (0 == aBlockSizes[j]) ? 64 * 1024 : aBlockSizes[j];
+    pCompressed = mdz_ansi_compressedCreate(pAnsi, aBlockSizes[j]);
+
+    if (!oCheck.expect(NULL != pCompressed && mdz_ansi_compressedSize(pCompressed) == strText.size(), "", "compressedCreate with block size %lu", (unsigned long) aBlockSizes[j]))
+    {
+      continue;
+    }
+
+    for (i = 0; i < nQueries; ++i)
+    {
+      k = (int) (oCheck.random()() % 4);
+
+      nLeftPos = (0 == i % 3) ? 0 : oCheck.random()() % strText.size();
+      nRightPos = (0 == i % 5) ? strText.size() - 1 : nLeftPos + oCheck.random()() % (strText.size() - nLeftPos);
+
+      if (0 == k || 1 == k)
+      {
+        /* sub-string of text, every second one crossing border of block */
+        nPos = (0 == k) ? oCheck.random()() % strText.size() : (1 + oCheck.random()() % (strText.size() / nBlockSize)) * nBlockSize - 1 - oCheck.random()() % 16;
+        strItems = strText.substr(nPos, 1 + oCheck.random()() % 40);
+
+        if (0 == oCheck.random()() % 4)
+        {
+          strItems[strItems.size() - 1] = (char) (strItems[strItems.size() - 1] + 1);
+        }
+      }
+      else if (2 == k)
+      {
+        strItems = aWords[oCheck.random()() % nWords];
+      }
+      else
+      {
+        strItems.assign(1 + oCheck.random()() % 4, ' ');
+        for (nPos = 0; nPos < strItems.size(); ++nPos)
+        {
+          strItems[nPos] = (char) (oCheck.random()() % 256);
+        }
+      }
+
+      nResult = mdz_ansi_compressedFind(pCompressed, nLeftPos, nRightPos, strItems.data(), strItems.size());
+      nReference = naiveFind(strText, nLeftPos, nRightPos, strItems);
+      oCheck.expect(nResult == nReference, strItems, "compressedFind in [%lu, %lu] block %lu: %lu, naive %lu",
+        (unsigned long) nLeftPos, (unsigned long) nRightPos, (unsigned long) nBlockSize, (unsigned long) nResult, (unsigned long) nReference);
+
+      nResult = mdz_ansi_compressedCount(pCompressed, nLeftPos, nRightPos, strItems.data(), strItems.size(), (i & 1) ? mdz_true : mdz_false);
+      nReference = naiveCount(strText, nLeftPos, nRightPos, strItems, 0 != (i & 1));
+      oCheck.expect(nResult == nReference, strItems, "compressedCount%s in [%lu, %lu] block %lu: %lu, naive %lu", (i & 1) ? " overlapped" : "",
+        (unsigned long) nLeftPos, (unsigned long) nRightPos, (unsigned long) nBlockSize, (unsigned long) nResult, (unsigned long) nReference);
+
+      if (0 == i % 16)
+      {
+        oCheck.expect(mdz_ansi_compressedCopy(pCompressed, nLeftPos, nRightPos, pCopy) && getText(pCopy) == strText.substr(nLeftPos, nRightPos - nLeftPos + 1), "",
+          "compressedCopy of [%lu, %lu] block %lu", (unsigned long) nLeftPos, (unsigned long) nRightPos, (unsigned long) nBlockSize);
+      }
+    }
+
+    mdz_ansi_compressedDestroy(&pCompressed);
+  }
+
+  oCheck.end();
+  mdz_ansi_destroy(&pCopy);
+  mdz_ansi_destroy(&pAnsi);
+}
+
+/**
+ * Code points of Windows-1252 bytes 0x80-0x9F (reference table, undefined bytes are C1 controls)
+ */
+const uint32_t g_aCp1252[32] =
+{
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+};
+
+uint32_t naiveCodePoint(unsigned char cItem, enum mdz_ansi_codepage enCodepage)
+{
+  return (MDZ_ANSI_CODEPAGE_WINDOWS1252 == enCodepage && cItem >= 0x80 && cItem < 0xA0) ? g_aCp1252[cItem - 0x80] : cItem;
+}
+
+/**
+ * Item of code point in enCodepage, or -1 if code point cannot be represented
+ */
+int naiveItem(uint32_t nCodePoint, enum mdz_ansi_codepage enCodepage)
+{
+  int i;
+
+  for (i = 0; i < 256; ++i)
+  {
+    if (naiveCodePoint((unsigned char) i, enCodepage) == nCodePoint)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+void naiveUtf8(uint32_t nCodePoint, std::string& strOut)
+{
+  if (nCodePoint < 0x80)
+  {
+    strOut += (char) nCodePoint;
+  }
+  else if (nCodePoint < 0x800)
+  {
+    strOut += (char) (0xC0 | (nCodePoint >> 6));
+    strOut += (char) (0x80 | (nCodePoint & 0x3F));
+  }
+  else if (nCodePoint < 0x10000)
+  {
+    strOut += (char) (0xE0 | (nCodePoint >> 12));
+    strOut += (char) (0x80 | ((nCodePoint >> 6) & 0x3F));
+    strOut += (char) (0x80 | (nCodePoint & 0x3F));
+  }
+  else
+  {
+    strOut += (char) (0xF0 | (nCodePoint >> 18));
+    strOut += (char) (0x80 | ((nCodePoint >> 12) & 0x3F));
+    strOut += (char) (0x80 | ((nCodePoint >> 6) & 0x3F));
+    strOut += (char) (0x80 | (nCodePoint & 0x3F));
+  }
+}
+
+/**
+ * UTF-16 unit as bytes in memory order of enEndianness
+ */
+void naiveUtf16(uint32_t nUnit, enum mdz_endianness enEndianness, std::string& strOut)
+{
+  strOut += (char) ((MDZ_ENDIAN_LITTLE == enEndianness) ? (nUnit & 0xFF) : (nUnit >> 8));
+  strOut += (char) ((MDZ_ENDIAN_LITTLE == enEndianness) ? (nUnit >> 8) : (nUnit & 0xFF));
+}
+
+/**
+ * Random code point: mostly ASCII (runs), also Latin-1, typographic characters of Windows-1252, other BMP characters and supplementary characters. No surrogates
+ */
+uint32_t randomCodePoint(Check& oCheck)
+{
+  const uint64_t nRandom = oCheck.random()();
+
+  switch (nRandom % 8)
+  {
+  case 0:
+    return 0x80 + (uint32_t) (nRandom >> 8) % 0x80;
+  case 1:
+    return g_aCp1252[(nRandom >> 8) % 32];
+  case 2:
+    return 0x100 + (uint32_t) (nRandom >> 8) % (0xD800 - 0x100);
+  case 3:
+    return ((nRandom >> 8) & 1) ? 0xE000 + (uint32_t) (nRandom >> 9) % 0x2000 : 0x10000 + (uint32_t) (nRandom >> 9) % 0x100000;
+  default:
+    return 1 + (uint32_t) (nRandom >> 8) % 0x7F;
+  }
+}
+
+/**
+ * Transcoding against naive per-item conversion: toUtf8/toUtf16 of random strings of both code pages (all byte values, ASCII runs shorter and longer than SIMD blocks)
+ * and round-trips back with fromUtf8/fromUtf16. fromUtf8/fromUtf16 of random characters (also not representable ones), and unpaired surrogates
+ */
+void checkTranscode(Check& oCheck)
+{
+  static const enum mdz_ansi_codepage aCodepages[] = { MDZ_ANSI_CODEPAGE_LATIN1, MDZ_ANSI_CODEPAGE_WINDOWS1252 };
+  static const enum mdz_endianness aEndianness[] = { MDZ_ENDIAN_LITTLE, MDZ_ENDIAN_BIG };
+  const size_t nStrings = std::max<size_t>(oCheck.count() / 10, 100);
+  struct mdz_Ansi* pAnsi = mdz_ansi_create(0);
+  struct mdz_Ansi* pUtf8 = mdz_ansi_create(0);
+  struct mdz_Ansi* pBack = mdz_ansi_create(0);
+  std::vector<uint16_t> vecUnits;
+  std::string strText;
+  std::string strReference;
+  std::string strUnits;
+  std::string strExpected;
+  uint32_t nCodePoint;
+  size_t nUnits;
+  int nItem;
+  size_t nLength;
+  size_t i;
+  size_t j;
+  size_t k;
+  size_t e;
+  bool bReplaced;
+  bool bConverted;
+
+  if (!oCheck.begin("transcode"))
+  {
+    mdz_ansi_destroy(&pBack);
+    mdz_ansi_destroy(&pUtf8);
+    mdz_ansi_destroy(&pAnsi);
+    return;
+  }
+
+  for (i = 0; i < nStrings; ++i)
+  {
+    /* ANSI -> UTF-8/UTF-16 -> ANSI */
+    nLength = 1 + oCheck.random()() % ((0 == i % 100) ? 5000 : 100);
+    strText.assign(nLength, ' ');
+    for (j = 0; j < nLength; ++j)
+    {
+      strText[j] = (0 == oCheck.random()() % 4) ? (char) (1 + oCheck.random()() % 255) : (char) (0x20 + oCheck.random()() % 0x5F);
+    }
+    setText(pAnsi, strText);
+
+    for (k = 0; k < 2; ++k)
+    {
+      strReference.clear();
+      for (j = 0; j < nLength; ++j)
+      {
+        naiveUtf8(naiveCodePoint((unsigned char) strText[j], aCodepages[k]), strReference);
+      }
+
+      oCheck.expect(mdz_ansi_toUtf8(pAnsi, 0, SIZE_MAX, aCodepages[k], pUtf8) && getText(pUtf8) == strReference, strText, "toUtf8 (code page %d)", (int) aCodepages[k]);
+
+      oCheck.expect(mdz_ansi_fromUtf8(pBack, (const unsigned char*) pUtf8->m_pData, mdz_ansi_size(pUtf8), aCodepages[k], '?') && MDZ_ERROR_NONE == pBack->m_enErrorCode
+        && getText(pBack) == strText, strText, "fromUtf8 (code page %d) of toUtf8 result", (int) aCodepages[k]);
+
+      for (e = 0; e < 2; ++e)
+      {
+        strReference.clear();
+        for (j = 0; j < nLength; ++j)
+        {
+          naiveUtf16(naiveCodePoint((unsigned char) strText[j], aCodepages[k]), aEndianness[e], strReference);
+        }
+
+        vecUnits.assign(nLength, 0);
+        nUnits = mdz_ansi_toUtf16(pAnsi, 0, SIZE_MAX, aCodepages[k], aEndianness[e], vecUnits.data(), vecUnits.size());
+        oCheck.expect(nUnits == nLength && 0 == memcmp(vecUnits.data(), strReference.data(), strReference.size()), strText, "toUtf16 (code page %d, endianness %d)",
+          (int) aCodepages[k], (int) aEndianness[e]);
+
+        oCheck.expect(mdz_ansi_fromUtf16(pBack, vecUnits.data(), nLength, aEndianness[e], aCodepages[k], '?') && MDZ_ERROR_NONE == pBack->m_enErrorCode
+          && getText(pBack) == strText, strText, "fromUtf16 (code page %d, endianness %d) of toUtf16 result", (int) aCodepages[k], (int) aEndianness[e]);
+      }
+    }
+
+    /* random characters -> ANSI: not representable characters (also surrogate pairs) are replaced with one item each */
+    nLength = 1 + oCheck.random()() % 100;
+    strReference.clear();
+    strUnits.clear();
+    strExpected.clear();
+    bReplaced = false;
+    k = i % 2;
+    e = (i / 2) % 2;
+
+    for (j = 0; j < nLength; ++j)
+    {
+      nCodePoint = randomCodePoint(oCheck);
+      naiveUtf8(nCodePoint, strReference);
+
+      if (nCodePoint >= 0x10000)
+      {
+        naiveUtf16(0xD800 + ((nCodePoint - 0x10000) >> 10), aEndianness[e], strUnits);
+        naiveUtf16(0xDC00 + ((nCodePoint - 0x10000) & 0x3FF), aEndianness[e], strUnits);
+      }
+      else
+      {
+        naiveUtf16(nCodePoint, aEndianness[e], strUnits);
+      }
+
+      nItem = naiveItem(nCodePoint, aCodepages[k]);
+      strExpected += (nItem < 0) ? '?' : (char) nItem;
+      bReplaced = bReplaced || nItem < 0;
+    }
+
+    bConverted = (mdz_true == mdz_ansi_fromUtf8(pBack, (const unsigned char*) strReference.data(), strReference.size(), aCodepages[k], '?'));
+    oCheck.expect(bConverted && getText(pBack) == strExpected && (bReplaced ? MDZ_ERROR_CONTENT : MDZ_ERROR_NONE) == pBack->m_enErrorCode, strReference,
+      "fromUtf8 (code page %d): \"%s\" error %d, expected \"%s\"", (int) aCodepages[k], getText(pBack).c_str(), (int) pBack->m_enErrorCode, strExpected.c_str());
+
+    vecUnits.assign(strUnits.size() / 2, 0);
+    memcpy(vecUnits.data(), strUnits.data(), strUnits.size());
+    bConverted = (mdz_true == mdz_ansi_fromUtf16(pBack, vecUnits.data(), vecUnits.size(), aEndianness[e], aCodepages[k], '?'));
+    oCheck.expect(bConverted && getText(pBack) == strExpected && (bReplaced ? MDZ_ERROR_CONTENT : MDZ_ERROR_NONE) == pBack->m_enErrorCode, strExpected,
+      "fromUtf16 (code page %d, endianness %d): \"%s\" error %d", (int) aCodepages[k], (int) aEndianness[e], getText(pBack).c_str(), (int) pBack->m_enErrorCode);
+
+    /* unpaired surrogates are replaced */
+    strUnits.clear();
+    naiveUtf16('A', aEndianness[e], strUnits);
+    naiveUtf16(0xD800 + (uint32_t) (oCheck.random()() % 0x400), aEndianness[e], strUnits);
+    naiveUtf16('B', aEndianness[e], strUnits);
+    naiveUtf16(0xDC00 + (uint32_t) (oCheck.random()() % 0x400), aEndianness[e], strUnits);
+    vecUnits.assign(strUnits.size() / 2, 0);
+    memcpy(vecUnits.data(), strUnits.data(), strUnits.size());
+    bConverted = (mdz_true == mdz_ansi_fromUtf16(pBack, vecUnits.data(), vecUnits.size(), aEndianness[e], aCodepages[k], '?'));
+    oCheck.expect(bConverted && getText(pBack) == "A?B?" && MDZ_ERROR_CONTENT == pBack->m_enErrorCode, "", "fromUtf16 of unpaired surrogates: \"%s\"", getText(pBack).c_str());
+  }
+
+  oCheck.end();
+  mdz_ansi_destroy(&pBack);
+  mdz_ansi_destroy(&pUtf8);
+  mdz_ansi_destroy(&pAnsi);
+}
+
+void usage()
+{
+  fprintf(stderr, "usage: mdz_ansi_check --license <file> [--count 100000] [--seed 1] [--filter <group>]\n");
+}
+
+} /* namespace */
+
+int main(int argc, char* argv[])
+{
+  Options oOptions;
+  int i;
+
+  for (i = 1; i + 1 < argc; i += 2)
+  {
+    const std::string strArg = argv[i];
+
+    if ("--license" == strArg)
+    {
+      oOptions.m_strLicense = argv[i + 1];
+    }
+    else if ("--count" == strArg)
+    {
+      oOptions.m_nCount = (size_t) strtoul(argv[i + 1], NULL, 10);
+    }
+    else if ("--seed" == strArg)
+    {
+      oOptions.m_nSeed = strtoul(argv[i + 1], NULL, 10);
+    }
+    else if ("--filter" == strArg)
+    {
+      oOptions.m_strFilter = argv[i + 1];
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if (i != argc || oOptions.m_strLicense.empty())
+  {
+    usage();
+    return 1;
+  }
+
+  if (!initLibrary(oOptions.m_strLicense))
+  {
+    fprintf(stderr, "mdz_ansi_init() failed\n");
+    return 1;
+  }
+
+  Check oCheck(oOptions);
+
+  checkInt(oCheck);
+  checkDouble(oCheck);
+  checkCompressed(oCheck);
+  checkTranscode(oCheck);
+
+  mdz_ansi_uninit();
+
+  printf("%s\n", (0 == oCheck.failures()) ? "all checks passed" : "checks FAILED");
+  return (0 == oCheck.failures()) ? 0 : 1;
+}
@@ -0,0 +1,543 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Bulk functions of mdz_ansi_ext: initialization and copying of huge ranges split between threads, using non-temporal (streaming) stores
+ * from MDZ_ANSI_EXT_STREAM_THRESHOLD bytes. Strings with data on (transparent) huge pages, optionally first-touched by worker threads.
+ *
+ */
+
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+#if !defined(_WIN32) && !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/**
+ * Size of huge page in bytes. Data of strings created with mdz_ansi_createHuge() is aligned on it
+ */
+#define MDZ_EXT_HUGE_PAGE (2 * 1024 * 1024)
+
+/**
+ * Granularity in bytes of data of strings created with mdz_ansi_createHuge() without huge pages (multiple of usual page sizes)
+ */
+#define MDZ_EXT_HUGE_GRANULARITY (64 * 1024)
+
+/**
+ * \defgroup Streaming kernels. Head of range is written with usual stores till alignment of vector, then non-temporal stores are used
+ */
+
+#ifdef MDZ_EXT_SSE2
+static void mdz_ext_fillSse2(unsigned char* pcDest, size_t nSize, unsigned char cItem)
+{
+  const __m128i xItem = _mm_set1_epi8((char) cItem);
+  size_t i = (16 - ((size_t) pcDest & 15)) & 15;
+
+  if (i > nSize)
+  {
+    i = nSize;
+  }
+
+  memset(pcDest, cItem, i);
+
+  for (; i + 16 <= nSize; i += 16)
+  {
+    _mm_stream_si128((__m128i*) (pcDest + i), xItem);
+  }
+
+  memset(pcDest + i, cItem, nSize - i);
+}
+
+static void mdz_ext_copySse2(unsigned char* pcDest, const unsigned char* pcSrc, size_t nSize)
+{
+  size_t i = (16 - ((size_t) pcDest & 15)) & 15;
+
+  if (i > nSize)
+  {
+    i = nSize;
+  }
+
+  memcpy(pcDest, pcSrc, i);
+
+  for (; i + 16 <= nSize; i += 16)
+  {
+    _mm_stream_si128((__m128i*) (pcDest + i), _mm_loadu_si128((const __m128i*) (pcSrc + i)));
+  }
+
+  memcpy(pcDest + i, pcSrc + i, nSize - i);
+}
+#endif
+
+#ifdef MDZ_EXT_AVX2
+MDZ_EXT_TARGET_AVX2
+static void mdz_ext_fillAvx2(unsigned char* pcDest, size_t nSize, unsigned char cItem)
+{
+  const __m256i yItem = _mm256_set1_epi8((char) cItem);
+  size_t i = (32 - ((size_t) pcDest & 31)) & 31;
+
+  if (i > nSize)
+  {
+    i = nSize;
+  }
+
+  memset(pcDest, cItem, i);
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    _mm256_stream_si256((__m256i*) (pcDest + i), yItem);
+  }
+
+  memset(pcDest + i, cItem, nSize - i);
+}
+
+MDZ_EXT_TARGET_AVX2
+static void mdz_ext_copyAvx2(unsigned char* pcDest, const unsigned char* pcSrc, size_t nSize)
+{
+  size_t i = (32 - ((size_t) pcDest & 31)) & 31;
+
+  if (i > nSize)
+  {
+    i = nSize;
+  }
+
+  memcpy(pcDest, pcSrc, i);
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    _mm256_stream_si256((__m256i*) (pcDest + i), _mm256_loadu_si256((const __m256i*) (pcSrc + i)));
+  }
+
+  memcpy(pcDest + i, pcSrc + i, nSize - i);
+}
+#endif
+
+struct mdz_ext_bulkContext
+{
+  unsigned char* m_pcDest;
+
+  /**
+   * Source of copying, or NULL if range is filled with m_cItem
+   */
+  const unsigned char* m_pcSrc;
+  unsigned char m_cItem;
+  mdz_bool m_bStream;
+};
+
+static void mdz_ext_bulkRange(void* pContext, size_t nFrom, size_t nTo)
+{
+  const struct mdz_ext_bulkContext* pBulk = (const struct mdz_ext_bulkContext*) pContext;
+  unsigned char* pcDest = pBulk->m_pcDest + nFrom;
+  const unsigned char* pcSrc = (NULL != pBulk->m_pcSrc) ? pBulk->m_pcSrc + nFrom : NULL;
+
+#ifdef MDZ_EXT_SSE2
+  if (pBulk->m_bStream)
+  {
+#ifdef MDZ_EXT_AVX2
+    if (mdz_ext_hasAvx2())
+    {
+      if (NULL != pcSrc)
+      {
+        mdz_ext_copyAvx2(pcDest, pcSrc, nTo - nFrom);
+      }
+      else
+      {
+        mdz_ext_fillAvx2(pcDest, nTo - nFrom, pBulk->m_cItem);
+      }
+
+      /* non-temporal stores are weakly ordered, thus they are fenced before chunk is reported as done */
+      _mm_sfence();
+      return;
+    }
+#endif
+    if (NULL != pcSrc)
+    {
+      mdz_ext_copySse2(pcDest, pcSrc, nTo - nFrom);
+    }
+    else
+    {
+      mdz_ext_fillSse2(pcDest, nTo - nFrom, pBulk->m_cItem);
+    }
+
+    _mm_sfence();
+    return;
+  }
+#endif
+
+  if (NULL != pcSrc)
+  {
+    memcpy(pcDest, pcSrc, nTo - nFrom);
+  }
+  else
+  {
+    memset(pcDest, pBulk->m_cItem, nTo - nFrom);
+  }
+}
+
+/**
+ * Fill (if pcSrc == NULL) or copy nSize bytes into pcDest. Return number of processed bytes (see mdz_ext_processRange()).
+ * bReallocated should be mdz_true if pcDest is just allocated: new pages are zeroed by OS through cache, thus non-temporal stores into them are slower than usual stores
+ */
+static size_t mdz_ext_bulk(unsigned char* pcDest, const unsigned char* pcSrc, unsigned char cItem, size_t nSize, mdz_bool bReallocated, const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_bulkContext oContext;
+
+  oContext.m_pcDest = pcDest;
+  oContext.m_pcSrc = pcSrc;
+  oContext.m_cItem = cItem;
+  oContext.m_bStream = (!bReallocated && nSize >= MDZ_ANSI_EXT_STREAM_THRESHOLD);
+
+  /* chunks are multiples of cache-line, thus threads do not write into the same lines */
+  return mdz_ext_processRange(nSize, 64, mdz_ext_bulkRange, &oContext, pAsyncData);
+}
+
+/**
+ * \defgroup Implementations of calls. If call is cancelled, implementations set *pnResume and return mdz_false. pnResume is not used if pAsyncData is NULL
+ */
+
+static mdz_bool mdz_ext_reserveAndInit(struct mdz_Ansi* pAnsi, size_t nNewCapacity, char cItem, const struct mdz_asyncData* pAsyncData, size_t* pnResume)
+{
+  enum mdz_error_code enError;
+  size_t nSize;
+  size_t nDone;
+
+  if (mdz_ansi_size(pAnsi) > 0)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_NONEMPTY);
+    return mdz_false;
+  }
+
+  if (!mdz_ansi_reserve(pAnsi, nNewCapacity))
+  {
+    return mdz_false;
+  }
+
+  /* MDZ_ERROR_CAPACITY is kept, if existing Capacity is initialized (without reallocation) */
+  enError = pAnsi->m_enErrorCode;
+
+  nSize = mdz_ansi_capacity(pAnsi);
+  if (0 == nSize)
+  {
+    return mdz_true;
+  }
+
+  --nSize;
+
+  nDone = mdz_ext_bulk((unsigned char*) pAnsi->m_pData, NULL, (unsigned char) cItem, nSize, MDZ_ERROR_CAPACITY != enError, pAsyncData);
+
+  mdz_ansi_resize(pAnsi, nDone);
+  mdz_ext_setError(pAnsi, enError);
+
+  if (nDone < nSize)
+  {
+    *pnResume = nDone;
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+static mdz_bool mdz_ext_copyFast(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, const struct mdz_asyncData* pAsyncData, size_t* pnResume)
+{
+  mdz_bool bReallocated;
+  size_t nSize;
+  size_t nDone;
+
+  if (!mdz_ext_checkSubAnsi(pAnsi, pSubAnsi))
+  {
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  nSize = nRightPos - nLeftPos + 1;
+
+  mdz_ansi_clear(pSubAnsi);
+  if (!mdz_ansi_reserve(pSubAnsi, nSize + 1))
+  {
+    return mdz_false;
+  }
+
+  /* Capacity of pSubAnsi was enough, if reservation reports MDZ_ERROR_CAPACITY */
+  bReallocated = (MDZ_ERROR_CAPACITY != pSubAnsi->m_enErrorCode);
+
+  nDone = mdz_ext_bulk((unsigned char*) pSubAnsi->m_pData, (const unsigned char*) pAnsi->m_pData + nLeftPos, 0, nSize, bReallocated, pAsyncData);
+
+  mdz_ansi_resize(pSubAnsi, nDone);
+
+  /* result is reported on pSubAnsi: pAnsi is only read, thus concurrent readers of it do not race */
+  mdz_ext_setError(pSubAnsi, MDZ_ERROR_NONE);
+
+  if (nDone < nSize)
+  {
+    *pnResume = nLeftPos + nDone;
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+/**
+ * \defgroup Asynchronous calls
+ */
+
+struct mdz_ext_bulkArgs
+{
+  const struct mdz_Ansi* m_pAnsi;
+  size_t m_nLeftPos;
+  size_t m_nRightPos;
+  char m_cItem;
+  struct mdz_Ansi* m_pSubAnsi;
+};
+
+static struct mdz_ext_bulkArgs* mdz_ext_bulkArgsCreate(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, char cItem, struct mdz_Ansi* pSubAnsi)
+{
+  struct mdz_ext_bulkArgs* pArgs = (struct mdz_ext_bulkArgs*) malloc(sizeof(struct mdz_ext_bulkArgs));
+
+  if (NULL != pArgs)
+  {
+    pArgs->m_pAnsi = pAnsi;
+    pArgs->m_nLeftPos = nLeftPos;
+    pArgs->m_nRightPos = nRightPos;
+    pArgs->m_cItem = cItem;
+    pArgs->m_pSubAnsi = pSubAnsi;
+  }
+
+  return pArgs;
+}
+
+static mdz_bool mdz_ext_reserveAndInitAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_bulkArgs* pArgs = (struct mdz_ext_bulkArgs*) pParam;
+  size_t nResume = SIZE_MAX;
+  mdz_bool bRet = mdz_ext_reserveAndInit((struct mdz_Ansi*) pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_cItem, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = (SIZE_MAX == nResume) ? (size_t) bRet : nResume;
+  return (SIZE_MAX == nResume);
+}
+
+static mdz_bool mdz_ext_copyFastAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_bulkArgs* pArgs = (struct mdz_ext_bulkArgs*) pParam;
+  size_t nResume = SIZE_MAX;
+  mdz_bool bRet = mdz_ext_copyFast(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pSubAnsi, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = (SIZE_MAX == nResume) ? (size_t) bRet : nResume;
+  return (SIZE_MAX == nResume);
+}
+
+/**
+ * \defgroup Huge data
+ */
+
+static char* mdz_ext_hugeAlloc(size_t* pnBytes, mdz_bool bHugePages)
+{
+  size_t nBytes = *pnBytes;
+  char* pData;
+#ifdef _WIN32
+  SIZE_T nLarge = bHugePages ? GetLargePageMinimum() : 0;
+
+  /* large pages need SeLockMemoryPrivilege, otherwise usual pages are used */
+  if (nLarge > 0 && nBytes <= SIZE_MAX - nLarge)
+  {
+    nBytes = (nBytes + nLarge - 1) / nLarge * nLarge;
+    pData = (char*) VirtualAlloc(NULL, nBytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    if (NULL != pData)
+    {
+      *pnBytes = nBytes;
+      return pData;
+    }
+  }
+
+  nBytes = (*pnBytes + MDZ_EXT_HUGE_GRANULARITY - 1) / MDZ_EXT_HUGE_GRANULARITY * MDZ_EXT_HUGE_GRANULARITY;
+  pData = (char*) VirtualAlloc(NULL, nBytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+  size_t nAlign = bHugePages ? MDZ_EXT_HUGE_PAGE : MDZ_EXT_HUGE_GRANULARITY;
+  size_t nHead;
+  char* pMap;
+
+  if (nBytes > SIZE_MAX - 2 * nAlign)
+  {
+    return NULL;
+  }
+
+  nBytes = (nBytes + nAlign - 1) / nAlign * nAlign;
+
+  /* mapping is made larger on nAlign, then unaligned head and tail are unmapped: thus huge pages can back the whole data */
+  pMap = (char*) mmap(NULL, nBytes + nAlign, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == (void*) pMap)
+  {
+    return NULL;
+  }
+
+  nHead = (nAlign - ((size_t) pMap & (nAlign - 1))) & (nAlign - 1);
+  if (nHead > 0)
+  {
+    munmap(pMap, nHead);
+  }
+
+  munmap(pMap + nHead + nBytes, nAlign - nHead);
+
+  pData = pMap + nHead;
+
+#ifdef MADV_HUGEPAGE
+  if (bHugePages)
+  {
+    madvise(pData, nBytes, MADV_HUGEPAGE);
+  }
+#endif
+#endif
+
+  if (NULL != pData)
+  {
+    *pnBytes = nBytes;
+  }
+
+  return pData;
+}
+
+static void mdz_ext_hugeFree(char* pData, size_t nBytes)
+{
+#ifdef _WIN32
+  (void) nBytes;
+  VirtualFree(pData, 0, MEM_RELEASE);
+#else
+  munmap(pData, nBytes);
+#endif
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_reserveAndInitFast_async(struct mdz_Ansi* pAnsi, size_t nNewCapacity, char cItem, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  size_t nResume;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_RESERVEANDINITFAST, NULL, 0, 0, pAnsi);
+
+  /* string is empty before initialization, thus bytes are counted from nNewCapacity */
+  if (oStatsCall.m_bActive && nNewCapacity > 0)
+  {
+    oStatsCall.m_nBytes = nNewCapacity - 1;
+  }
+
+  if (NULL != pAsyncData)
+  {
+    /* nNewCapacity is passed as nLeftPos */
+    return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_reserveAndInitAsync, mdz_ext_bulkArgsCreate(pAnsi, nNewCapacity, 0, cItem, NULL), &oStatsCall);
+  }
+
+  bRet = mdz_ext_reserveAndInit(pAnsi, nNewCapacity, cItem, NULL, &nResume);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_copyFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  size_t nResume;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_COPYFAST, pAnsi, nLeftPos, nRightPos, pSubAnsi);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_copyFastAsync, mdz_ext_bulkArgsCreate(pAnsi, nLeftPos, nRightPos, 0, pSubAnsi), &oStatsCall);
+  }
+
+  bRet = mdz_ext_copyFast(pAnsi, nLeftPos, nRightPos, pSubAnsi, NULL, &nResume);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+struct mdz_Ansi* mdz_ansi_createHuge(size_t nCapacity, mdz_bool bHugePages, mdz_bool bFirstTouch)
+{
+  struct mdz_Ansi* pAnsi;
+  size_t nBytes = nCapacity;
+  char* pData;
+
+  if (0 == nCapacity)
+  {
+    return NULL;
+  }
+
+  pData = mdz_ext_hugeAlloc(&nBytes, bHugePages);
+  if (NULL == pData)
+  {
+    return NULL;
+  }
+
+  /* pages are placed on NUMA node of thread, which touches them first: workers touch their chunks in parallel */
+  if (bFirstTouch)
+  {
+    mdz_ext_bulk((unsigned char*) pData, NULL, 0, nBytes, mdz_true, NULL);
+  }
+
+  pAnsi = mdz_ansi_create(0);
+  if (NULL == pAnsi)
+  {
+    mdz_ext_hugeFree(pData, nBytes);
+    return NULL;
+  }
+
+  /* new pages are zeroed, thus pData[0] is terminator of empty string */
+  if (!mdz_ansi_attachData(pAnsi, pData, 0, nBytes, MDZ_ATTACH_ZEROSIZE))
+  {
+    mdz_ansi_destroy(&pAnsi);
+    mdz_ext_hugeFree(pData, nBytes);
+    return NULL;
+  }
+
+  return pAnsi;
+}
+
+void mdz_ansi_destroyHuge(struct mdz_Ansi** ppAnsi)
+{
+  char* pData;
+  size_t nOffset;
+  size_t nBytes;
+
+  if (NULL == ppAnsi || NULL == *ppAnsi)
+  {
+    return;
+  }
+
+  nOffset = mdz_ansi_offsetFromStart(*ppAnsi);
+  pData = (*ppAnsi)->m_pData - nOffset;
+  nBytes = mdz_ansi_capacity(*ppAnsi) + nOffset;
+
+  mdz_ansi_destroy(ppAnsi);
+  mdz_ext_hugeFree(pData, nBytes);
+}
@@ -0,0 +1,685 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Byte-set membership kernels of mdz_ansi_ext: scalar, SSE2 (up to 4 items) and AVX2 (any set, using nibble bitmaps).
+ * Compaction kernel: runs are moved using memmove(), or items are compressed 8 at a time using shuffle table with AVX2.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+void mdz_ext_byteSetInit(struct mdz_ext_byteSet* pSet, const unsigned char* pcItems, size_t nCount)
+{
+  size_t i;
+
+  memset(pSet, 0, sizeof(struct mdz_ext_byteSet));
+
+  for (i = 0; i < nCount; ++i)
+  {
+    mdz_ext_byteSetAdd(pSet, pcItems[i]);
+  }
+}
+
+void mdz_ext_byteSetAdd(struct mdz_ext_byteSet* pSet, unsigned char cItem)
+{
+  if (pSet->m_aLookup[cItem])
+  {
+    return;
+  }
+
+  pSet->m_aLookup[cItem] = 1;
+  pSet->m_aBitmap[cItem >> 7][cItem & 0x0F] |= (unsigned char) (1u << ((cItem >> 4) & 7));
+
+  if (pSet->m_nCount < sizeof(pSet->m_aItems))
+  {
+    pSet->m_aItems[pSet->m_nCount] = cItem;
+  }
+
+  pSet->m_nCount++;
+}
+
+static size_t mdz_ext_byteSetFirstScalar(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  const unsigned char* pcLookup = pSet->m_aLookup;
+  const unsigned char cMatch = (unsigned char) (bMember ? 1 : 0);
+  size_t i = 0;
+
+  for (; i + 4 <= nSize; i += 4)
+  {
+    if (pcLookup[pcData[i]] == cMatch)
+    {
+      return i;
+    }
+    if (pcLookup[pcData[i + 1]] == cMatch)
+    {
+      return i + 1;
+    }
+    if (pcLookup[pcData[i + 2]] == cMatch)
+    {
+      return i + 2;
+    }
+    if (pcLookup[pcData[i + 3]] == cMatch)
+    {
+      return i + 3;
+    }
+  }
+
+  for (; i < nSize; ++i)
+  {
+    if (pcLookup[pcData[i]] == cMatch)
+    {
+      return i;
+    }
+  }
+
+  return nSize;
+}
+
+static size_t mdz_ext_byteSetLastScalar(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  const unsigned char* pcLookup = pSet->m_aLookup;
+  const unsigned char cMatch = (unsigned char) (bMember ? 1 : 0);
+  size_t i = nSize;
+
+  for (; i >= 4; i -= 4)
+  {
+    if (pcLookup[pcData[i - 1]] == cMatch)
+    {
+      return i - 1;
+    }
+    if (pcLookup[pcData[i - 2]] == cMatch)
+    {
+      return i - 2;
+    }
+    if (pcLookup[pcData[i - 3]] == cMatch)
+    {
+      return i - 3;
+    }
+    if (pcLookup[pcData[i - 4]] == cMatch)
+    {
+      return i - 4;
+    }
+  }
+
+  for (; i > 0; --i)
+  {
+    if (pcLookup[pcData[i - 1]] == cMatch)
+    {
+      return i - 1;
+    }
+  }
+
+  return nSize;
+}
+
+#ifdef MDZ_EXT_SSE2
+static size_t mdz_ext_byteSetFirstSse2(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  const __m128i xItem0 = _mm_set1_epi8((char) pSet->m_aItems[0]);
+  const __m128i xItem1 = _mm_set1_epi8((char) pSet->m_aItems[pSet->m_nCount > 1 ? 1 : 0]);
+  const __m128i xItem2 = _mm_set1_epi8((char) pSet->m_aItems[pSet->m_nCount > 2 ? 2 : 0]);
+  const __m128i xItem3 = _mm_set1_epi8((char) pSet->m_aItems[pSet->m_nCount > 3 ? 3 : 0]);
+  const unsigned int nInvert = bMember ? 0 : 0xFFFF;
+  unsigned int nMask;
+  __m128i xData;
+  __m128i xHit;
+  size_t i = 0;
+
+  for (; i + 16 <= nSize; i += 16)
+  {
+    xData = _mm_loadu_si128((const __m128i*) (pcData + i));
+    xHit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(xData, xItem0), _mm_cmpeq_epi8(xData, xItem1)),
+                        _mm_or_si128(_mm_cmpeq_epi8(xData, xItem2), _mm_cmpeq_epi8(xData, xItem3)));
+
+    nMask = ((unsigned int) _mm_movemask_epi8(xHit)) ^ nInvert;
+    if (0 != nMask)
+    {
+      return i + mdz_ext_ctz32(nMask);
+    }
+  }
+
+  return i + mdz_ext_byteSetFirstScalar(pSet, pcData + i, nSize - i, bMember);
+}
+
+static size_t mdz_ext_byteSetLastSse2(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  const __m128i xItem0 = _mm_set1_epi8((char) pSet->m_aItems[0]);
+  const __m128i xItem1 = _mm_set1_epi8((char) pSet->m_aItems[pSet->m_nCount > 1 ? 1 : 0]);
+  const __m128i xItem2 = _mm_set1_epi8((char) pSet->m_aItems[pSet->m_nCount > 2 ? 2 : 0]);
+  const __m128i xItem3 = _mm_set1_epi8((char) pSet->m_aItems[pSet->m_nCount > 3 ? 3 : 0]);
+  const unsigned int nInvert = bMember ? 0 : 0xFFFF;
+  unsigned int nMask;
+  size_t nLast;
+  __m128i xData;
+  __m128i xHit;
+  size_t i = nSize;
+
+  for (; i >= 16; i -= 16)
+  {
+    xData = _mm_loadu_si128((const __m128i*) (pcData + i - 16));
+    xHit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(xData, xItem0), _mm_cmpeq_epi8(xData, xItem1)),
+                        _mm_or_si128(_mm_cmpeq_epi8(xData, xItem2), _mm_cmpeq_epi8(xData, xItem3)));
+
+    nMask = ((unsigned int) _mm_movemask_epi8(xHit)) ^ nInvert;
+    if (0 != nMask)
+    {
+      return i - 16 + 31 - mdz_ext_clz32(nMask);
+    }
+  }
+
+  nLast = mdz_ext_byteSetLastScalar(pSet, pcData, i, bMember);
+  return (nLast < i) ? nLast : nSize;
+}
+#endif
+
+#ifdef MDZ_EXT_AVX2
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_byteSetFirstAvx2(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  const __m256i yBitmapLow = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) pSet->m_aBitmap[0]));
+  const __m256i yBitmapHigh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) pSet->m_aBitmap[1]));
+  const __m256i yBits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+  const __m256i yNibble = _mm256_set1_epi8(0x0F);
+  const unsigned int nInvert = bMember ? 0 : 0xFFFFFFFFu;
+  unsigned int nMask;
+  __m256i yData;
+  __m256i yRow;
+  __m256i yBit;
+  size_t i = 0;
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    yData = _mm256_loadu_si256((const __m256i*) (pcData + i));
+
+    /* row of high-nibble bits for low nibble; bitmap is selected by highest bit of byte */
+    yRow = _mm256_blendv_epi8(_mm256_shuffle_epi8(yBitmapLow, _mm256_and_si256(yData, yNibble)),
+                              _mm256_shuffle_epi8(yBitmapHigh, _mm256_and_si256(yData, yNibble)), yData);
+    yBit = _mm256_shuffle_epi8(yBits, _mm256_and_si256(_mm256_srli_epi16(yData, 4), yNibble));
+
+    nMask = ((unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(yRow, yBit), yBit))) ^ nInvert;
+    if (0 != nMask)
+    {
+      return i + mdz_ext_ctz32(nMask);
+    }
+  }
+
+  return i + mdz_ext_byteSetFirstScalar(pSet, pcData + i, nSize - i, bMember);
+}
+
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_byteSetLastAvx2(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  const __m256i yBitmapLow = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) pSet->m_aBitmap[0]));
+  const __m256i yBitmapHigh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) pSet->m_aBitmap[1]));
+  const __m256i yBits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+  const __m256i yNibble = _mm256_set1_epi8(0x0F);
+  const unsigned int nInvert = bMember ? 0 : 0xFFFFFFFFu;
+  unsigned int nMask;
+  size_t nLast;
+  __m256i yData;
+  __m256i yRow;
+  __m256i yBit;
+  size_t i = nSize;
+
+  for (; i >= 32; i -= 32)
+  {
+    yData = _mm256_loadu_si256((const __m256i*) (pcData + i - 32));
+
+    yRow = _mm256_blendv_epi8(_mm256_shuffle_epi8(yBitmapLow, _mm256_and_si256(yData, yNibble)),
+                              _mm256_shuffle_epi8(yBitmapHigh, _mm256_and_si256(yData, yNibble)), yData);
+    yBit = _mm256_shuffle_epi8(yBits, _mm256_and_si256(_mm256_srli_epi16(yData, 4), yNibble));
+
+    nMask = ((unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(yRow, yBit), yBit))) ^ nInvert;
+    if (0 != nMask)
+    {
+      return i - 32 + 31 - mdz_ext_clz32(nMask);
+    }
+  }
+
+  nLast = mdz_ext_byteSetLastScalar(pSet, pcData, i, bMember);
+  return (nLast < i) ? nLast : nSize;
+}
+#endif
+
+size_t mdz_ext_byteSetFirst(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  if (0 == pSet->m_nCount)
+  {
+    return bMember ? nSize : 0;
+  }
+
+  if (bMember && 1 == pSet->m_nCount)
+  {
+    const unsigned char* pcFound = (const unsigned char*) memchr(pcData, pSet->m_aItems[0], nSize);
+    return (NULL != pcFound) ? (size_t) (pcFound - pcData) : nSize;
+  }
+
+#ifdef MDZ_EXT_AVX2
+  if (nSize >= 64 && mdz_ext_hasAvx2())
+  {
+    return mdz_ext_byteSetFirstAvx2(pSet, pcData, nSize, bMember);
+  }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+  if (nSize >= 32 && pSet->m_nCount <= sizeof(pSet->m_aItems))
+  {
+    return mdz_ext_byteSetFirstSse2(pSet, pcData, nSize, bMember);
+  }
+#endif
+
+  return mdz_ext_byteSetFirstScalar(pSet, pcData, nSize, bMember);
+}
+
+size_t mdz_ext_byteSetLast(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember)
+{
+  if (0 == pSet->m_nCount)
+  {
+    return (bMember || 0 == nSize) ? nSize : nSize - 1;
+  }
+
+#ifdef MDZ_EXT_AVX2
+  if (nSize >= 64 && mdz_ext_hasAvx2())
+  {
+    return mdz_ext_byteSetLastAvx2(pSet, pcData, nSize, bMember);
+  }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+  if (nSize >= 32 && pSet->m_nCount <= sizeof(pSet->m_aItems))
+  {
+    return mdz_ext_byteSetLastSse2(pSet, pcData, nSize, bMember);
+  }
+#endif
+
+  return mdz_ext_byteSetLastScalar(pSet, pcData, nSize, bMember);
+}
+
+static size_t mdz_ext_byteSetCompactScalar(const struct mdz_ext_byteSet* pSet, unsigned char* pcDest, size_t nWrite, const unsigned char* pcSrc, size_t nFrom, size_t nTo)
+{
+  size_t nKeep;
+  size_t nEnd;
+
+  while (nFrom < nTo)
+  {
+    nKeep = nFrom + mdz_ext_byteSetFirst(pSet, pcSrc + nFrom, nTo - nFrom, mdz_false);
+    if (nKeep >= nTo)
+    {
+      break;
+    }
+
+    nEnd = nKeep + mdz_ext_byteSetFirst(pSet, pcSrc + nKeep, nTo - nKeep, mdz_true);
+
+    if (pcDest + nWrite != pcSrc + nKeep)
+    {
+      memmove(pcDest + nWrite, pcSrc + nKeep, nEnd - nKeep);
+    }
+
+    nWrite += nEnd - nKeep;
+    nFrom = nEnd;
+  }
+
+  return nWrite;
+}
+
+#ifdef MDZ_EXT_AVX2
+
+/**
+ * Shuffle indexes for compression of 8 items: m_aShuffle[nKeepMask] contains indexes of kept items (0x80 for unused bytes), m_aCount[nKeepMask] their number
+ */
+static const unsigned char m_aShuffle[256][8] =
+{
+  { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80 },
+  { 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x80, 0x80, 0x80, 0x80 },
+  { 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80 },
+  { 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x03, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x05, 0x80, 0x80, 0x80 },
+  { 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x05, 0x80, 0x80, 0x80 },
+  { 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80 },
+  { 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x03, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x06, 0x80, 0x80, 0x80 },
+  { 0x04, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x06, 0x80, 0x80, 0x80 },
+  { 0x03, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x06, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x06, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x06, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x80, 0x80 },
+  { 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x03, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x80, 0x80 },
+  { 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x80, 0x80 },
+  { 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80 },
+  { 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x03, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x07, 0x80, 0x80, 0x80 },
+  { 0x04, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x07, 0x80, 0x80, 0x80 },
+  { 0x03, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x07, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0x80, 0x80 },
+  { 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x03, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0x80, 0x80 },
+  { 0x04, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x05, 0x07, 0x80, 0x80 },
+  { 0x03, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x05, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x05, 0x07, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x80 },
+  { 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x02, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x03, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x02, 0x03, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0x80, 0x80 },
+  { 0x04, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x02, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0x80, 0x80 },
+  { 0x03, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x06, 0x07, 0x80, 0x80 },
+  { 0x02, 0x03, 0x04, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x80 },
+  { 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x01, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x02, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x02, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x03, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x03, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x02, 0x03, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x80 },
+  { 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80 },
+  { 0x00, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x01, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x02, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x80 },
+  { 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80 },
+  { 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80 },
+  { 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80 },
+  { 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80 },
+  { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80 },
+  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 }
+};
+
+static const unsigned char m_aCount[256] =
+{
+  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+  1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+  1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+  2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+  1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6,
+  2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+  2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7,
+  3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8
+};
+
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_byteSetCompactAvx2(const struct mdz_ext_byteSet* pSet, unsigned char* pcDest, size_t nWrite, const unsigned char* pcSrc, size_t nFrom, size_t nTo)
+{
+  const __m256i yBitmapLow = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) pSet->m_aBitmap[0]));
+  const __m256i yBitmapHigh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) pSet->m_aBitmap[1]));
+  const __m256i yBits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                         1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+  const __m256i yNibble = _mm256_set1_epi8(0x0F);
+  const __m128i xHighHalf = _mm_set1_epi8(8);
+  unsigned int nKeep;
+  unsigned int nPart;
+  __m256i yData;
+  __m256i yRow;
+  __m256i yBit;
+  __m128i xLane;
+
+  for (; nFrom + 32 <= nTo; nFrom += 32)
+  {
+    /* whole block is loaded before any store: stores at nWrite never reach beyond the block, if destination is not ahead of source */
+    yData = _mm256_loadu_si256((const __m256i*) (pcSrc + nFrom));
+
+    yRow = _mm256_blendv_epi8(_mm256_shuffle_epi8(yBitmapLow, _mm256_and_si256(yData, yNibble)),
+                              _mm256_shuffle_epi8(yBitmapHigh, _mm256_and_si256(yData, yNibble)), yData);
+    yBit = _mm256_shuffle_epi8(yBits, _mm256_and_si256(_mm256_srli_epi16(yData, 4), yNibble));
+
+    nKeep = ~(unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(yRow, yBit), yBit));
+
+    if (0xFFFFFFFFu == nKeep)
+    {
+      if (pcDest + nWrite != pcSrc + nFrom)
+      {
+        _mm256_storeu_si256((__m256i*) (pcDest + nWrite), yData);
+      }
+      nWrite += 32;
+      continue;
+    }
+
+    if (0 == nKeep)
+    {
+      continue;
+    }
+
+    xLane = _mm256_castsi256_si128(yData);
+    nPart = nKeep & 0xFF;
+    _mm_storel_epi64((__m128i*) (pcDest + nWrite), _mm_shuffle_epi8(xLane, _mm_loadl_epi64((const __m128i*) m_aShuffle[nPart])));
+    nWrite += m_aCount[nPart];
+
+    nPart = (nKeep >> 8) & 0xFF;
+    _mm_storel_epi64((__m128i*) (pcDest + nWrite), _mm_shuffle_epi8(xLane, _mm_add_epi8(_mm_loadl_epi64((const __m128i*) m_aShuffle[nPart]), xHighHalf)));
+    nWrite += m_aCount[nPart];
+
+    xLane = _mm256_extracti128_si256(yData, 1);
+    nPart = (nKeep >> 16) & 0xFF;
+    _mm_storel_epi64((__m128i*) (pcDest + nWrite), _mm_shuffle_epi8(xLane, _mm_loadl_epi64((const __m128i*) m_aShuffle[nPart])));
+    nWrite += m_aCount[nPart];
+
+    nPart = nKeep >> 24;
+    _mm_storel_epi64((__m128i*) (pcDest + nWrite), _mm_shuffle_epi8(xLane, _mm_add_epi8(_mm_loadl_epi64((const __m128i*) m_aShuffle[nPart]), xHighHalf)));
+    nWrite += m_aCount[nPart];
+  }
+
+  return mdz_ext_byteSetCompactScalar(pSet, pcDest, nWrite, pcSrc, nFrom, nTo);
+}
+#endif
+
+size_t mdz_ext_byteSetCompact(const struct mdz_ext_byteSet* pSet, unsigned char* pcDest, size_t nWrite, const unsigned char* pcSrc, size_t nFrom, size_t nTo)
+{
+#ifdef MDZ_EXT_AVX2
+  if (nTo - nFrom >= 64 && mdz_ext_hasAvx2())
+  {
+    return mdz_ext_byteSetCompactAvx2(pSet, pcDest, nWrite, pcSrc, nFrom, nTo);
+  }
+#endif
+
+  return mdz_ext_byteSetCompactScalar(pSet, pcDest, nWrite, pcSrc, nFrom, nTo);
+}
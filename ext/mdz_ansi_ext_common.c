@@ -0,0 +1,447 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Common part of mdz_ansi_ext: range validation, CPU dispatch and threading helpers.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+#if defined(_MSC_VER) && defined(MDZ_EXT_X86)
+#include <intrin.h>
+#endif
+
+/**
+ * \defgroup Validation
+ */
+
+mdz_bool mdz_ext_checkRange(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t* pnRightPos)
+{
+  size_t nSize = mdz_ansi_size(pAnsi);
+
+  if (SIZE_MAX == *pnRightPos && nSize > 0)
+  {
+    *pnRightPos = nSize - 1;
+  }
+
+  if (*pnRightPos >= nSize)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_BIGRIGHT);
+    return mdz_false;
+  }
+
+  if (nLeftPos > *pnRightPos)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_BIGLEFT);
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+mdz_bool mdz_ext_checkItems(const struct mdz_Ansi* pAnsi, const char* pcItems, size_t* pnCount)
+{
+  if (NULL == pcItems)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_ITEMS);
+    return mdz_false;
+  }
+
+  if (0 == *pnCount)
+  {
+    *pnCount = strlen(pcItems);
+
+    if (0 == *pnCount)
+    {
+      mdz_ext_setError(pAnsi, MDZ_ERROR_ZEROCOUNT);
+      return mdz_false;
+    }
+  }
+
+  return mdz_true;
+}
+
+mdz_bool mdz_ext_checkSubAnsi(const struct mdz_Ansi* pAnsi, struct mdz_Ansi* pSubAnsi)
+{
+  if (NULL == pSubAnsi || pSubAnsi == pAnsi)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_SUBCONTAINER);
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+/**
+ * \defgroup CPU dispatch
+ */
+
+static int m_nHasAvx2 = -1;
+
+static size_t m_nCpuCount = 0;
+
+mdz_bool mdz_ext_hasAvx2(void)
+{
+  if (m_nHasAvx2 < 0)
+  {
+#if defined(MDZ_EXT_AVX2) && defined(__GNUC__)
+    __builtin_cpu_init();
+    m_nHasAvx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+#elif defined(MDZ_EXT_AVX2) && defined(_MSC_VER)
+    int aInfo[4];
+    m_nHasAvx2 = 0;
+    __cpuid(aInfo, 0);
+    if (aInfo[0] >= 7)
+    {
+      __cpuid(aInfo, 1);
+      /* OSXSAVE and AVX, YMM state enabled by OS */
+      if ((aInfo[2] & (1 << 27)) && (aInfo[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6)
+      {
+        __cpuidex(aInfo, 7, 0);
+        m_nHasAvx2 = (aInfo[1] & (1 << 5)) ? 1 : 0;
+      }
+    }
+#else
+    m_nHasAvx2 = 0;
+#endif
+  }
+
+  return (mdz_bool) m_nHasAvx2;
+}
+
+size_t mdz_ext_cpuCount(void)
+{
+  if (0 == m_nCpuCount)
+  {
+#ifdef _WIN32
+    SYSTEM_INFO oInfo;
+    GetSystemInfo(&oInfo);
+    m_nCpuCount = (size_t) oInfo.dwNumberOfProcessors;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long nCount = sysconf(_SC_NPROCESSORS_ONLN);
+    m_nCpuCount = (nCount > 0) ? (size_t) nCount : 1;
+#else
+    m_nCpuCount = 1;
+#endif
+    if (0 == m_nCpuCount)
+    {
+      m_nCpuCount = 1;
+    }
+  }
+
+  return m_nCpuCount;
+}
+
+#ifdef _MSC_VER
+unsigned int mdz_ext_ctz32(unsigned int nValue)
+{
+  unsigned long nIndex;
+  _BitScanForward(&nIndex, nValue);
+  return (unsigned int) nIndex;
+}
+
+unsigned int mdz_ext_clz32(unsigned int nValue)
+{
+  unsigned long nIndex;
+  _BitScanReverse(&nIndex, nValue);
+  return 31 - (unsigned int) nIndex;
+}
+#endif
+
+/**
+ * \defgroup Threading
+ */
+
+#ifdef _WIN32
+#ifdef _WIN64
+#define mdz_ext_fetchAdd(pnTarget, nValue) ((size_t) InterlockedExchangeAdd64((volatile LONG64*) (pnTarget), (LONG64) (nValue)))
+#else
+#define mdz_ext_fetchAdd(pnTarget, nValue) ((size_t) InterlockedExchangeAdd((volatile LONG*) (pnTarget), (LONG) (nValue)))
+#endif
+#else
+#define mdz_ext_fetchAdd(pnTarget, nValue) __sync_fetch_and_add((pnTarget), (nValue))
+#endif
+
+/**
+ * Range shared by workers. Workers claim chunks in increasing order and finish every claimed chunk, thus processed part of range is always [0, m_nNext)
+ */
+struct mdz_ext_rangeShared
+{
+  mdz_ext_rangeFunc m_pfnRange;
+  void* m_pContext;
+  const struct mdz_asyncData* m_pAsyncData;
+  size_t m_nSize;
+  size_t m_nChunk;
+  volatile size_t m_nNext;
+};
+
+struct mdz_ext_rangeWorker
+{
+  struct mdz_ext_rangeShared* m_pShared;
+#ifdef _WIN32
+  HANDLE m_hThread;
+#else
+  pthread_t m_hThread;
+#endif
+};
+
+static void mdz_ext_runWorker(struct mdz_ext_rangeWorker* pWorker)
+{
+  struct mdz_ext_rangeShared* pShared = pWorker->m_pShared;
+  size_t nFrom;
+
+  for (;;)
+  {
+    /* m_bCancel is checked before claiming, thus claimed chunk is always finished */
+    if (mdz_ext_isCancelled(pShared->m_pAsyncData))
+    {
+      return;
+    }
+
+    nFrom = mdz_ext_fetchAdd(&pShared->m_nNext, pShared->m_nChunk);
+    if (nFrom >= pShared->m_nSize)
+    {
+      return;
+    }
+
+    pShared->m_pfnRange(pShared->m_pContext, nFrom, (pShared->m_nSize - nFrom > pShared->m_nChunk) ? nFrom + pShared->m_nChunk : pShared->m_nSize);
+  }
+}
+
+/**
+ * Body of started worker. Worker of asynchronous call is counted by scheduler from its start (see mdz_ext_processRange()) till return of this function
+ */
+static void mdz_ext_runStartedWorker(struct mdz_ext_rangeWorker* pWorker)
+{
+  const struct mdz_asyncData* pAsyncData = pWorker->m_pShared->m_pAsyncData;
+
+  mdz_ext_runWorker(pWorker);
+
+  if (NULL != pAsyncData)
+  {
+    mdz_ext_schedWorker(pAsyncData, mdz_false);
+  }
+
+  mdz_ext_statsRelease();
+}
+
+#ifdef _WIN32
+static DWORD WINAPI mdz_ext_workerThread(LPVOID pParam)
+{
+  mdz_ext_runStartedWorker((struct mdz_ext_rangeWorker*) pParam);
+  return 0;
+}
+#else
+static void* mdz_ext_workerThread(void* pParam)
+{
+  mdz_ext_runStartedWorker((struct mdz_ext_rangeWorker*) pParam);
+  return NULL;
+}
+#endif
+
+static mdz_bool mdz_ext_startWorker(struct mdz_ext_rangeWorker* pWorker)
+{
+#ifdef _WIN32
+  pWorker->m_hThread = CreateThread(NULL, 0, mdz_ext_workerThread, pWorker, 0, NULL);
+  return (NULL != pWorker->m_hThread);
+#else
+  return (0 == pthread_create(&pWorker->m_hThread, NULL, mdz_ext_workerThread, pWorker));
+#endif
+}
+
+static void mdz_ext_joinWorker(struct mdz_ext_rangeWorker* pWorker)
+{
+#ifdef _WIN32
+  WaitForSingleObject(pWorker->m_hThread, INFINITE);
+  CloseHandle(pWorker->m_hThread);
+#else
+  pthread_join(pWorker->m_hThread, NULL);
+#endif
+}
+
+size_t mdz_ext_processRange(size_t nSize, size_t nAlign, mdz_ext_rangeFunc pfnRange, void* pContext, const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_rangeWorker aWorkers[MDZ_ANSI_EXT_MAX_THREADS];
+  mdz_bool aStarted[MDZ_ANSI_EXT_MAX_THREADS];
+  struct mdz_ext_rangeShared oShared;
+  size_t nThreads = 1;
+  size_t i;
+
+  if (0 == nAlign)
+  {
+    nAlign = 1;
+  }
+
+  if (nSize >= MDZ_ANSI_EXT_PARALLEL_THRESHOLD)
+  {
+    nThreads = mdz_ext_cpuCount();
+    if (nThreads > MDZ_ANSI_EXT_MAX_THREADS)
+    {
+      nThreads = MDZ_ANSI_EXT_MAX_THREADS;
+    }
+  }
+
+  if (1 == nThreads && NULL == pAsyncData)
+  {
+    if (nSize > 0)
+    {
+      pfnRange(pContext, 0, nSize);
+    }
+    return nSize;
+  }
+
+  oShared.m_pfnRange = pfnRange;
+  oShared.m_pContext = pContext;
+  oShared.m_pAsyncData = pAsyncData;
+  oShared.m_nSize = nSize;
+  oShared.m_nChunk = (MDZ_ANSI_EXT_CANCEL_CHUNK + nAlign - 1) / nAlign * nAlign;
+  oShared.m_nNext = 0;
+
+  /* worker 0 runs on calling thread. If other workers cannot be started, their chunks are claimed by running workers */
+  for (i = 0; i < nThreads; ++i)
+  {
+    aWorkers[i].m_pShared = &oShared;
+    aStarted[i] = mdz_false;
+  }
+
+  /* workers of asynchronous call are counted as its running threads by scheduler */
+  for (i = 1; i < nThreads; ++i)
+  {
+    if (NULL != pAsyncData)
+    {
+      mdz_ext_schedWorker(pAsyncData, mdz_true);
+    }
+
+    aStarted[i] = mdz_ext_startWorker(&aWorkers[i]);
+    if (aStarted[i])
+    {
+      mdz_ext_statsThread(mdz_false);
+    }
+    else if (NULL != pAsyncData)
+    {
+      mdz_ext_schedWorker(pAsyncData, mdz_false);
+    }
+  }
+
+  mdz_ext_runWorker(&aWorkers[0]);
+
+  for (i = 1; i < nThreads; ++i)
+  {
+    if (aStarted[i])
+    {
+      mdz_ext_joinWorker(&aWorkers[i]);
+    }
+  }
+
+  return (oShared.m_nNext < nSize) ? oShared.m_nNext : nSize;
+}
+
+struct mdz_ext_asyncCall
+{
+  mdz_ext_asyncFunc m_pfnAsync;
+  void* m_pArgs;
+  struct mdz_asyncData* m_pAsyncData;
+  struct mdz_ext_statsCall m_oStatsCall;
+  struct mdz_ext_schedTask m_oTask;
+};
+
+static void mdz_ext_runAsync(struct mdz_ext_asyncCall* pCall)
+{
+  struct mdz_asyncData* pAsyncData = pCall->m_pAsyncData;
+  mdz_bool bFinished = pCall->m_pfnAsync(pCall->m_pArgs, pAsyncData);
+
+  mdz_ext_schedLeave(&pCall->m_oTask);
+  mdz_ext_statsEnd(&pCall->m_oStatsCall, mdz_true);
+  mdz_ext_statsRelease();
+
+  free(pCall->m_pArgs);
+  free(pCall);
+
+  *(volatile mdz_bool*) &pAsyncData->m_bFinished = bFinished;
+
+  mdz_ext_queuePost(pAsyncData, mdz_true);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI mdz_ext_asyncThread(LPVOID pParam)
+{
+  mdz_ext_runAsync((struct mdz_ext_asyncCall*) pParam);
+  return 0;
+}
+#else
+static void* mdz_ext_asyncThread(void* pParam)
+{
+  mdz_ext_runAsync((struct mdz_ext_asyncCall*) pParam);
+  return NULL;
+}
+#endif
+
+mdz_bool mdz_ext_startAsync(struct mdz_Ansi* pAnsi, struct mdz_asyncData* pAsyncData, mdz_ext_asyncFunc pfnAsync, void* pArgs, struct mdz_ext_statsCall* pStatsCall)
+{
+  struct mdz_ext_asyncCall* pCall;
+
+  pAsyncData->m_pString = pAnsi;
+  pAsyncData->m_nResult = 0;
+  pAsyncData->m_pData = NULL;
+  pAsyncData->m_bFinished = mdz_false;
+
+  if (NULL == pArgs)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    mdz_ext_setError(pAnsi, MDZ_ERROR_THREAD_ALLOC);
+    mdz_ext_statsEnd(pStatsCall, mdz_true);
+    mdz_ext_queuePost(pAsyncData, mdz_false);
+    return mdz_false;
+  }
+
+  pCall = (struct mdz_ext_asyncCall*) malloc(sizeof(struct mdz_ext_asyncCall));
+  if (NULL == pCall)
+  {
+    free(pArgs);
+    mdz_ext_schedDiscard(pAsyncData);
+    mdz_ext_setError(pAnsi, MDZ_ERROR_THREAD_ALLOC);
+    mdz_ext_statsEnd(pStatsCall, mdz_true);
+    mdz_ext_queuePost(pAsyncData, mdz_false);
+    return mdz_false;
+  }
+
+  pCall->m_pfnAsync = pfnAsync;
+  pCall->m_pArgs = pArgs;
+  pCall->m_pAsyncData = pAsyncData;
+  pCall->m_oStatsCall = *pStatsCall;
+
+  /* call is added to scheduler before its thread is started, thus deadline is counted from the call */
+  mdz_ext_schedEnter(&pCall->m_oTask, pAsyncData);
+
+#ifdef _WIN32
+  pAsyncData->m_hThread = CreateThread(NULL, 0, mdz_ext_asyncThread, pCall, 0, NULL);
+  if (NULL == pAsyncData->m_hThread)
+#else
+  if (0 != pthread_create(&pAsyncData->m_hThread, NULL, mdz_ext_asyncThread, pCall))
+#endif
+  {
+    mdz_ext_schedLeave(&pCall->m_oTask);
+    free(pArgs);
+    free(pCall);
+    mdz_ext_setError(pAnsi, MDZ_ERROR_THREAD_START);
+    mdz_ext_statsEnd(pStatsCall, mdz_true);
+    mdz_ext_queuePost(pAsyncData, mdz_false);
+    return mdz_false;
+  }
+
+  mdz_ext_statsThread(mdz_true);
+  return mdz_true;
+}
@@ -0,0 +1,966 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Compressed strings of mdz_ansi_ext. String is split into blocks, which are compressed independently (LZ4-like format: literal runs and matches with 16-bit offsets)
+ * and carry filters of contained bytes and byte pairs. Search decompresses only blocks, filters of which may contain searched items. Occurrences crossing block borders
+ * are searched in copies of bytes around borders ("seams"), thus short items are found there without decompression.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+/**
+ * Default size of block in bytes
+ */
+#define MDZ_EXT_BLOCK_DEFAULT (64 * 1024)
+
+/**
+ * Minimal size of block in bytes
+ */
+#define MDZ_EXT_BLOCK_MIN 1024
+
+/**
+ * Number of bytes copied into seam from each side of block border. Occurrences of up to MDZ_EXT_SEAM + 1 items crossing border are found in seam
+ */
+#define MDZ_EXT_SEAM 32
+
+/**
+ * Maximal number of bits in filter of byte pairs of block. Filter of small blocks has up to nBlockSize / 2 bits (at least MDZ_EXT_PAIR_BITS_MIN)
+ */
+#define MDZ_EXT_PAIR_BITS 4096
+
+#define MDZ_EXT_PAIR_BITS_MIN 256
+
+/**
+ * Number of bits of hash of 4-byte sequences in compressor
+ */
+#define MDZ_EXT_LZ_HASH_BITS 14
+
+#define MDZ_EXT_LZ_MIN_MATCH 4
+
+/**
+ * Last bytes of block, which are always literals
+ */
+#define MDZ_EXT_LZ_LAST_LITERALS 5
+
+/**
+ * Match cannot start in the last MDZ_EXT_LZ_MATCH_LIMIT bytes of block
+ */
+#define MDZ_EXT_LZ_MATCH_LIMIT 12
+
+#define MDZ_EXT_LZ_MAX_OFFSET 65535
+
+struct mdz_ext_block
+{
+  /**
+   * Compressed data, or data itself if m_nSize equals to size of block (block is not compressible)
+   */
+  unsigned char* m_pcData;
+  size_t m_nSize;
+
+  /**
+   * Bit b is set if block contains byte b
+   */
+  unsigned char m_aBytes[32];
+};
+
+struct mdz_ansi_compressed
+{
+  size_t m_nSize;
+  size_t m_nBlockSize;
+  size_t m_nBlocks;
+  struct mdz_ext_block* m_pBlocks;
+
+  /**
+   * Filters of byte pairs of blocks, m_nPairBytes per block. Bit mdz_ext_pairHash(a, b, m_nPairShift) is set if block contains byte a followed by byte b
+   */
+  unsigned char* m_pcPairs;
+  size_t m_nPairBytes;
+  unsigned int m_nPairShift;
+
+  /**
+   * 2 * MDZ_EXT_SEAM bytes around border after every block except the last one
+   */
+  unsigned char* m_pcSeams;
+};
+
+#define mdz_ext_bitTest(pcBits, nBit) (0 != ((pcBits)[(nBit) >> 3] & (1u << ((nBit) & 7))))
+
+#define mdz_ext_bitSet(pcBits, nBit) ((pcBits)[(nBit) >> 3] |= (unsigned char) (1u << ((nBit) & 7)))
+
+static size_t mdz_ext_pairHash(unsigned char cFirst, unsigned char cSecond, unsigned int nShift)
+{
+  return (size_t) ((uint32_t) (((uint32_t) cFirst << 8 | cSecond) * 2654435761u) >> nShift);
+}
+
+static size_t mdz_ext_blockRawSize(const struct mdz_ansi_compressed* pCompressed, size_t nIndex)
+{
+  size_t nStart = nIndex * pCompressed->m_nBlockSize;
+
+  return (pCompressed->m_nSize - nStart < pCompressed->m_nBlockSize) ? pCompressed->m_nSize - nStart : pCompressed->m_nBlockSize;
+}
+
+/**
+ * \defgroup Block codec
+ */
+
+static uint32_t mdz_ext_read32(const unsigned char* pcData)
+{
+  uint32_t nValue;
+
+  memcpy(&nValue, pcData, sizeof(nValue));
+  return nValue;
+}
+
+/**
+ * Write length remainder (after 15 in token) as sequence of 255 bytes and the last byte
+ */
+static unsigned char* mdz_ext_lzWriteLength(unsigned char* pcOut, size_t nLength)
+{
+  for (; nLength >= 255; nLength -= 255)
+  {
+    *pcOut++ = 255;
+  }
+
+  *pcOut++ = (unsigned char) nLength;
+  return pcOut;
+}
+
+/**
+ * Write sequence of nLiterals literals from pcLiterals, followed by match of nMatch bytes at nOffset (no match if nMatch == 0). Return NULL if output does not fit below pcOutEnd
+ */
+static unsigned char* mdz_ext_lzWriteSequence(unsigned char* pcOut, const unsigned char* pcOutEnd, const unsigned char* pcLiterals, size_t nLiterals, size_t nOffset, size_t nMatch)
+{
+  unsigned char* pcToken = pcOut;
+  size_t nMatchCode = (nMatch > 0) ? nMatch - MDZ_EXT_LZ_MIN_MATCH : 0;
+
+  /* token, literal length bytes, literals, offset and match length bytes */
+  if ((size_t) (pcOutEnd - pcOut) < 1 + nLiterals / 255 + 1 + nLiterals + 2 + nMatchCode / 255 + 1)
+  {
+    return NULL;
+  }
+
+  *pcToken = (unsigned char) (((nLiterals < 15) ? nLiterals : 15) << 4);
+  ++pcOut;
+
+  if (nLiterals >= 15)
+  {
+    pcOut = mdz_ext_lzWriteLength(pcOut, nLiterals - 15);
+  }
+
+  memcpy(pcOut, pcLiterals, nLiterals);
+  pcOut += nLiterals;
+
+  if (0 == nMatch)
+  {
+    return pcOut;
+  }
+
+  *pcToken |= (unsigned char) ((nMatchCode < 15) ? nMatchCode : 15);
+  *pcOut++ = (unsigned char) (nOffset & 0xFF);
+  *pcOut++ = (unsigned char) (nOffset >> 8);
+
+  if (nMatchCode >= 15)
+  {
+    pcOut = mdz_ext_lzWriteLength(pcOut, nMatchCode - 15);
+  }
+
+  return pcOut;
+}
+
+/**
+ * Compress nSize bytes of pcSrc into pcDest of nCapacity bytes. pnTable is hash table of (1 << MDZ_EXT_LZ_HASH_BITS) entries.
+ * Return size of compressed data, or 0 if it does not fit into nCapacity bytes
+ */
+static size_t mdz_ext_lzCompress(const unsigned char* pcSrc, size_t nSize, unsigned char* pcDest, size_t nCapacity, uint32_t* pnTable)
+{
+  const unsigned char* pcDestEnd = pcDest + nCapacity;
+  unsigned char* pcOut = pcDest;
+  size_t nAnchor = 0;
+  size_t nPos = 0;
+  size_t nCandidate;
+  size_t nMatch;
+  size_t nMatchLimit;
+  size_t nHash;
+  uint32_t nSequence;
+
+  memset(pnTable, 0, sizeof(uint32_t) << MDZ_EXT_LZ_HASH_BITS);
+
+  if (nSize > MDZ_EXT_LZ_MATCH_LIMIT)
+  {
+    nMatchLimit = nSize - MDZ_EXT_LZ_LAST_LITERALS;
+
+    while (nPos < nSize - MDZ_EXT_LZ_MATCH_LIMIT)
+    {
+      nSequence = mdz_ext_read32(pcSrc + nPos);
+      nHash = (size_t) ((nSequence * 2654435761u) >> (32 - MDZ_EXT_LZ_HASH_BITS));
+
+      /* positions are stored +1, 0 is empty entry */
+      nCandidate = pnTable[nHash];
+      pnTable[nHash] = (uint32_t) (nPos + 1);
+
+      if (0 == nCandidate || nPos - (nCandidate - 1) > MDZ_EXT_LZ_MAX_OFFSET || mdz_ext_read32(pcSrc + nCandidate - 1) != nSequence)
+      {
+        /* step grows in runs without matches, thus incompressible data is passed quickly */
+        nPos += 1 + ((nPos - nAnchor) >> 6);
+        continue;
+      }
+
+      --nCandidate;
+
+      for (nMatch = MDZ_EXT_LZ_MIN_MATCH; nPos + nMatch < nMatchLimit && pcSrc[nCandidate + nMatch] == pcSrc[nPos + nMatch]; ++nMatch)
+      {
+      }
+
+      for (; nPos > nAnchor && nCandidate > 0 && pcSrc[nPos - 1] == pcSrc[nCandidate - 1]; --nPos, --nCandidate, ++nMatch)
+      {
+      }
+
+      pcOut = mdz_ext_lzWriteSequence(pcOut, pcDestEnd, pcSrc + nAnchor, nPos - nAnchor, nPos - nCandidate, nMatch);
+      if (NULL == pcOut)
+      {
+        return 0;
+      }
+
+      nPos += nMatch;
+      nAnchor = nPos;
+
+      /* position near end of match is hashed too, thus following repetitions are found */
+      if (nPos < nSize - MDZ_EXT_LZ_MATCH_LIMIT)
+      {
+        pnTable[(mdz_ext_read32(pcSrc + nPos - 2) * 2654435761u) >> (32 - MDZ_EXT_LZ_HASH_BITS)] = (uint32_t) (nPos - 2 + 1);
+      }
+    }
+  }
+
+  pcOut = mdz_ext_lzWriteSequence(pcOut, pcDestEnd, pcSrc + nAnchor, nSize - nAnchor, 0, 0);
+
+  return (NULL != pcOut) ? (size_t) (pcOut - pcDest) : 0;
+}
+
+/**
+ * Read length remainder written by mdz_ext_lzWriteLength(). Return mdz_false if input ends
+ */
+static mdz_bool mdz_ext_lzReadLength(const unsigned char** ppcIn, const unsigned char* pcInEnd, size_t* pnLength)
+{
+  unsigned char cByte;
+
+  do
+  {
+    if (*ppcIn >= pcInEnd)
+    {
+      return mdz_false;
+    }
+
+    cByte = *(*ppcIn)++;
+    *pnLength += cByte;
+  }
+  while (255 == cByte);
+
+  return mdz_true;
+}
+
+/**
+ * Decompress nSrcSize bytes of pcSrc into pcDest of nDestSize bytes. Return mdz_true if exactly nDestSize bytes are decompressed
+ */
+static mdz_bool mdz_ext_lzDecompress(const unsigned char* pcSrc, size_t nSrcSize, unsigned char* pcDest, size_t nDestSize)
+{
+  const unsigned char* pcInEnd = pcSrc + nSrcSize;
+  size_t nOut = 0;
+  size_t nLiterals;
+  size_t nOffset;
+  size_t nMatch;
+  unsigned char cToken;
+
+  while (pcSrc < pcInEnd)
+  {
+    cToken = *pcSrc++;
+
+    nLiterals = cToken >> 4;
+    if (15 == nLiterals && !mdz_ext_lzReadLength(&pcSrc, pcInEnd, &nLiterals))
+    {
+      return mdz_false;
+    }
+
+    if (nLiterals > (size_t) (pcInEnd - pcSrc) || nLiterals > nDestSize - nOut)
+    {
+      return mdz_false;
+    }
+
+    memcpy(pcDest + nOut, pcSrc, nLiterals);
+    pcSrc += nLiterals;
+    nOut += nLiterals;
+
+    /* the last sequence has no match */
+    if (pcSrc == pcInEnd)
+    {
+      break;
+    }
+
+    if (pcInEnd - pcSrc < 2)
+    {
+      return mdz_false;
+    }
+
+    nOffset = (size_t) pcSrc[0] | ((size_t) pcSrc[1] << 8);
+    pcSrc += 2;
+
+    nMatch = cToken & 15;
+    if (15 == nMatch && !mdz_ext_lzReadLength(&pcSrc, pcInEnd, &nMatch))
+    {
+      return mdz_false;
+    }
+
+    nMatch += MDZ_EXT_LZ_MIN_MATCH;
+
+    if (0 == nOffset || nOffset > nOut || nMatch > nDestSize - nOut)
+    {
+      return mdz_false;
+    }
+
+    /* match may overlap its own output (repeated patterns), then it is copied item by item */
+    if (nOffset >= nMatch)
+    {
+      memcpy(pcDest + nOut, pcDest + nOut - nOffset, nMatch);
+      nOut += nMatch;
+    }
+    else
+    {
+      for (; nMatch > 0; --nMatch, ++nOut)
+      {
+        pcDest[nOut] = pcDest[nOut - nOffset];
+      }
+    }
+  }
+
+  return (nOut == nDestSize);
+}
+
+/**
+ * Return data of block nIndex: decompressed into pcScratch (at least m_nBlockSize bytes), or data of block itself if it is not compressed. NULL if data is corrupted
+ */
+static const unsigned char* mdz_ext_blockData(const struct mdz_ansi_compressed* pCompressed, size_t nIndex, unsigned char* pcScratch)
+{
+  const struct mdz_ext_block* pBlock = &pCompressed->m_pBlocks[nIndex];
+  size_t nRawSize = mdz_ext_blockRawSize(pCompressed, nIndex);
+
+  if (pBlock->m_nSize == nRawSize)
+  {
+    return pBlock->m_pcData;
+  }
+
+  return mdz_ext_lzDecompress(pBlock->m_pcData, pBlock->m_nSize, pcScratch, nRawSize) ? pcScratch : NULL;
+}
+
+/**
+ * \defgroup Compression. Blocks are compressed by threads, which claim chunks of whole blocks
+ */
+
+struct mdz_ext_compressContext
+{
+  const unsigned char* m_pcData;
+  struct mdz_ansi_compressed* m_pCompressed;
+  volatile mdz_bool m_bFailed;
+};
+
+static void mdz_ext_compressRange(void* pContext, size_t nFrom, size_t nTo)
+{
+  struct mdz_ext_compressContext* pCompress = (struct mdz_ext_compressContext*) pContext;
+  struct mdz_ansi_compressed* pCompressed = pCompress->m_pCompressed;
+  struct mdz_ext_block* pBlock;
+  const unsigned char* pcRaw;
+  unsigned char* pcPairs;
+  unsigned char* pcOut;
+  uint32_t* pnTable;
+  size_t nRawSize;
+  size_t nSize;
+  size_t nIndex;
+  size_t i;
+
+  pnTable = (uint32_t*) malloc((sizeof(uint32_t) << MDZ_EXT_LZ_HASH_BITS) + pCompressed->m_nBlockSize);
+  if (NULL == pnTable)
+  {
+    pCompress->m_bFailed = mdz_true;
+    return;
+  }
+
+  pcOut = (unsigned char*) (pnTable + ((size_t) 1 << MDZ_EXT_LZ_HASH_BITS));
+
+  for (nIndex = nFrom / pCompressed->m_nBlockSize; nIndex * pCompressed->m_nBlockSize < nTo; ++nIndex)
+  {
+    pBlock = &pCompressed->m_pBlocks[nIndex];
+    pcRaw = pCompress->m_pcData + nIndex * pCompressed->m_nBlockSize;
+    nRawSize = mdz_ext_blockRawSize(pCompressed, nIndex);
+
+    pcPairs = pCompressed->m_pcPairs + nIndex * pCompressed->m_nPairBytes;
+
+    memset(pBlock->m_aBytes, 0, sizeof(pBlock->m_aBytes));
+    memset(pcPairs, 0, pCompressed->m_nPairBytes);
+
+    mdz_ext_bitSet(pBlock->m_aBytes, pcRaw[0]);
+    for (i = 1; i < nRawSize; ++i)
+    {
+      mdz_ext_bitSet(pBlock->m_aBytes, pcRaw[i]);
+      mdz_ext_bitSet(pcPairs, mdz_ext_pairHash(pcRaw[i - 1], pcRaw[i], pCompressed->m_nPairShift));
+    }
+
+    /* block is stored uncompressed if compression does not make it smaller */
+    nSize = mdz_ext_lzCompress(pcRaw, nRawSize, pcOut, nRawSize - 1, pnTable);
+    if (0 == nSize)
+    {
+      nSize = nRawSize;
+    }
+
+    pBlock->m_pcData = (unsigned char*) malloc(nSize);
+    if (NULL == pBlock->m_pcData)
+    {
+      pCompress->m_bFailed = mdz_true;
+      break;
+    }
+
+    memcpy(pBlock->m_pcData, (nSize == nRawSize) ? pcRaw : pcOut, nSize);
+    pBlock->m_nSize = nSize;
+  }
+
+  free(pnTable);
+}
+
+/**
+ * \defgroup Decompression. Blocks are decompressed by threads, which claim chunks of whole blocks. Range of processing starts at the beginning of first block
+ */
+
+struct mdz_ext_decompressContext
+{
+  const struct mdz_ansi_compressed* m_pCompressed;
+  unsigned char* m_pcDest;
+
+  /**
+   * Range [m_nLeftPos, m_nEnd) of string to decompress, m_nFirst is start of its first block
+   */
+  size_t m_nLeftPos;
+  size_t m_nEnd;
+  size_t m_nFirst;
+  volatile mdz_bool m_bFailed;
+};
+
+static void mdz_ext_decompressRange(void* pContext, size_t nFrom, size_t nTo)
+{
+  struct mdz_ext_decompressContext* pDecompress = (struct mdz_ext_decompressContext*) pContext;
+  const struct mdz_ansi_compressed* pCompressed = pDecompress->m_pCompressed;
+  const struct mdz_ext_block* pBlock;
+  const unsigned char* pcData;
+  unsigned char* pcScratch = NULL;
+  size_t nStart;
+  size_t nEnd;
+  size_t nCopyFrom;
+  size_t nCopyTo;
+  size_t nIndex;
+
+  for (nStart = pDecompress->m_nFirst + nFrom; nStart < pDecompress->m_nFirst + nTo; nStart += pCompressed->m_nBlockSize)
+  {
+    nIndex = nStart / pCompressed->m_nBlockSize;
+    pBlock = &pCompressed->m_pBlocks[nIndex];
+    nEnd = nStart + mdz_ext_blockRawSize(pCompressed, nIndex);
+
+    nCopyFrom = (nStart > pDecompress->m_nLeftPos) ? nStart : pDecompress->m_nLeftPos;
+    nCopyTo = (nEnd < pDecompress->m_nEnd) ? nEnd : pDecompress->m_nEnd;
+
+    /* whole compressed blocks are decompressed directly into destination */
+    if (nCopyFrom == nStart && nCopyTo == nEnd && pBlock->m_nSize != nEnd - nStart)
+    {
+      if (!mdz_ext_lzDecompress(pBlock->m_pcData, pBlock->m_nSize, pDecompress->m_pcDest + (nStart - pDecompress->m_nLeftPos), nEnd - nStart))
+      {
+        pDecompress->m_bFailed = mdz_true;
+      }
+
+      continue;
+    }
+
+    if (NULL == pcScratch && pBlock->m_nSize != nEnd - nStart)
+    {
+      pcScratch = (unsigned char*) malloc(pCompressed->m_nBlockSize);
+      if (NULL == pcScratch)
+      {
+        pDecompress->m_bFailed = mdz_true;
+        return;
+      }
+    }
+
+    pcData = mdz_ext_blockData(pCompressed, nIndex, pcScratch);
+    if (NULL == pcData)
+    {
+      pDecompress->m_bFailed = mdz_true;
+      continue;
+    }
+
+    memcpy(pDecompress->m_pcDest + (nCopyFrom - pDecompress->m_nLeftPos), pcData + (nCopyFrom - nStart), nCopyTo - nCopyFrom);
+  }
+
+  free(pcScratch);
+}
+
+/**
+ * Decompress range [nLeftPos, nEnd) into pcDest. Return mdz_false if memory allocation failed or data is corrupted
+ */
+static mdz_bool mdz_ext_decompress(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nEnd, unsigned char* pcDest)
+{
+  struct mdz_ext_decompressContext oContext;
+
+  oContext.m_pCompressed = pCompressed;
+  oContext.m_pcDest = pcDest;
+  oContext.m_nLeftPos = nLeftPos;
+  oContext.m_nEnd = nEnd;
+  oContext.m_nFirst = nLeftPos - nLeftPos % pCompressed->m_nBlockSize;
+  oContext.m_bFailed = mdz_false;
+
+  mdz_ext_processRange(nEnd - oContext.m_nFirst, pCompressed->m_nBlockSize, mdz_ext_decompressRange, &oContext, NULL);
+
+  return !oContext.m_bFailed;
+}
+
+/**
+ * \defgroup Search
+ */
+
+struct mdz_ext_scan
+{
+  const unsigned char* m_pcItems;
+  size_t m_nCount;
+  mdz_bool m_bCount;
+  mdz_bool m_bAllowOverlapped;
+
+  /**
+   * First position, from which next occurrence may start (after previous counted occurrence)
+   */
+  size_t m_nNext;
+  size_t m_nFound;
+  size_t m_nTotal;
+  mdz_bool m_bDone;
+};
+
+/**
+ * Search occurrences starting in [nFrom, nTo] in pcData, first byte of which is at position nBase. pcData must contain range [nFrom, nTo + m_nCount)
+ */
+static void mdz_ext_scanWindow(struct mdz_ext_scan* pScan, const unsigned char* pcData, size_t nBase, size_t nFrom, size_t nTo)
+{
+  size_t nPos = (nFrom > pScan->m_nNext) ? nFrom : pScan->m_nNext;
+  size_t nFound;
+
+  while (!pScan->m_bDone && nPos <= nTo)
+  {
+    nFound = mdz_ext_findData(pcData + (nPos - nBase), nTo - nPos + pScan->m_nCount, pScan->m_pcItems, pScan->m_nCount);
+    if (nFound > nTo - nPos)
+    {
+      break;
+    }
+
+    nPos += nFound;
+
+    if (!pScan->m_bCount)
+    {
+      pScan->m_nFound = nPos;
+      pScan->m_bDone = mdz_true;
+      break;
+    }
+
+    ++pScan->m_nTotal;
+    nPos += pScan->m_bAllowOverlapped ? 1 : pScan->m_nCount;
+    pScan->m_nNext = nPos;
+  }
+}
+
+/**
+ * Return mdz_true if filters of block nIndex do not exclude occurrence of items inside block
+ */
+static mdz_bool mdz_ext_blockMayContain(const struct mdz_ansi_compressed* pCompressed, size_t nIndex, const unsigned char* pcItems, size_t nCount)
+{
+  const struct mdz_ext_block* pBlock = &pCompressed->m_pBlocks[nIndex];
+  const unsigned char* pcPairs = pCompressed->m_pcPairs + nIndex * pCompressed->m_nPairBytes;
+  size_t i;
+
+  for (i = 0; i < nCount; ++i)
+  {
+    if (!mdz_ext_bitTest(pBlock->m_aBytes, pcItems[i]))
+    {
+      return mdz_false;
+    }
+  }
+
+  for (i = 1; i < nCount; ++i)
+  {
+    if (!mdz_ext_bitTest(pcPairs, mdz_ext_pairHash(pcItems[i - 1], pcItems[i], pCompressed->m_nPairShift)))
+    {
+      return mdz_false;
+    }
+  }
+
+  return mdz_true;
+}
+
+/**
+ * Search occurrences of pScan items starting in [nLeftPos, nLast]. Occurrences inside blocks are searched in blocks, filters of which do not exclude them,
+ * occurrences crossing block borders are searched in seams (or in the both decompressed blocks for long items). Return mdz_false if memory allocation failed or data is corrupted
+ */
+static mdz_bool mdz_ext_scanBlocks(const struct mdz_ansi_compressed* pCompressed, struct mdz_ext_scan* pScan, size_t nLeftPos, size_t nLast)
+{
+  const size_t nBlockSize = pCompressed->m_nBlockSize;
+  const size_t nCount = pScan->m_nCount;
+  const unsigned char* pcData;
+  const unsigned char* pcNext;
+  unsigned char* pcScratch;
+  unsigned char* pcWindow;
+  size_t nIndex;
+  size_t nStart;
+  size_t nEnd;
+  size_t nFrom;
+  size_t nTo;
+  mdz_bool bRet = mdz_true;
+
+  /* scratch: 2 decompressed blocks and window of long items crossing border */
+  pcScratch = (unsigned char*) malloc(2 * nBlockSize + 2 * nCount);
+  if (NULL == pcScratch)
+  {
+    return mdz_false;
+  }
+
+  pcWindow = pcScratch + 2 * nBlockSize;
+
+  for (nIndex = nLeftPos / nBlockSize; bRet && !pScan->m_bDone && nIndex * nBlockSize <= nLast; ++nIndex)
+  {
+    nStart = nIndex * nBlockSize;
+    nEnd = nStart + mdz_ext_blockRawSize(pCompressed, nIndex);
+    nFrom = (nStart > nLeftPos) ? nStart : nLeftPos;
+    nTo = (nEnd - 1 < nLast) ? nEnd - 1 : nLast;
+    pcData = NULL;
+
+    /* occurrences inside block */
+    if (nEnd - nStart >= nCount && nFrom + nCount <= nEnd && mdz_ext_blockMayContain(pCompressed, nIndex, pScan->m_pcItems, nCount))
+    {
+      pcData = mdz_ext_blockData(pCompressed, nIndex, pcScratch);
+      if (NULL == pcData)
+      {
+        bRet = mdz_false;
+        break;
+      }
+
+      mdz_ext_scanWindow(pScan, pcData, nStart, nFrom, (nTo < nEnd - nCount) ? nTo : nEnd - nCount);
+    }
+
+    /* occurrences crossing border after block. nTo + nCount <= Size, thus they do not reach past the next block */
+    if (1 == nCount || nEnd == pCompressed->m_nSize || nTo + nCount <= nEnd || pScan->m_bDone)
+    {
+      continue;
+    }
+
+    if (nFrom + nCount <= nEnd)
+    {
+      nFrom = nEnd - nCount + 1;
+    }
+
+    if (nCount - 1 <= MDZ_EXT_SEAM)
+    {
+      mdz_ext_scanWindow(pScan, pCompressed->m_pcSeams + 2 * MDZ_EXT_SEAM * nIndex, nEnd - MDZ_EXT_SEAM, nFrom, nTo);
+      continue;
+    }
+
+    if (!mdz_ext_bitTest(pCompressed->m_pBlocks[nIndex].m_aBytes, pScan->m_pcItems[0]) || !mdz_ext_bitTest(pCompressed->m_pBlocks[nIndex + 1].m_aBytes, pScan->m_pcItems[nCount - 1]))
+    {
+      continue;
+    }
+
+    if (NULL == pcData)
+    {
+      pcData = mdz_ext_blockData(pCompressed, nIndex, pcScratch);
+    }
+
+    pcNext = mdz_ext_blockData(pCompressed, nIndex + 1, pcScratch + nBlockSize);
+    if (NULL == pcData || NULL == pcNext)
+    {
+      bRet = mdz_false;
+      break;
+    }
+
+    memcpy(pcWindow, pcData + (nFrom - nStart), nEnd - nFrom);
+    memcpy(pcWindow + (nEnd - nFrom), pcNext, nTo + nCount - nEnd);
+    mdz_ext_scanWindow(pScan, pcWindow, nFrom, nFrom, nTo);
+  }
+
+  free(pcScratch);
+  return bRet;
+}
+
+/**
+ * Search occurrences of nCount items of pcItems between nLeftPos and nRightPos. Nothing is found if parameters are invalid.
+ * Return mdz_false if memory allocation failed or data is corrupted
+ */
+static mdz_bool mdz_ext_compressedScan(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_ext_scan* pScan)
+{
+  unsigned char* pcData;
+  mdz_bool bRet;
+
+  pScan->m_nNext = nLeftPos;
+  pScan->m_nFound = pCompressed->m_nSize;
+  pScan->m_nTotal = 0;
+  pScan->m_bDone = mdz_false;
+
+  if (SIZE_MAX == nRightPos)
+  {
+    nRightPos = pCompressed->m_nSize - 1;
+  }
+
+  if (NULL == pcItems || nLeftPos > nRightPos || nRightPos >= pCompressed->m_nSize)
+  {
+    return mdz_true;
+  }
+
+  if (0 == nCount)
+  {
+    nCount = strlen(pcItems);
+  }
+
+  if (0 == nCount || nCount > nRightPos - nLeftPos + 1)
+  {
+    return mdz_true;
+  }
+
+  pScan->m_pcItems = (const unsigned char*) pcItems;
+  pScan->m_nCount = nCount;
+
+  if (nCount <= pCompressed->m_nBlockSize)
+  {
+    return mdz_ext_scanBlocks(pCompressed, pScan, nLeftPos, nRightPos + 1 - nCount);
+  }
+
+  /* items longer than block are searched in decompressed range */
+  pcData = (unsigned char*) malloc(nRightPos - nLeftPos + 1);
+  if (NULL == pcData)
+  {
+    return mdz_false;
+  }
+
+  bRet = mdz_ext_decompress(pCompressed, nLeftPos, nRightPos + 1, pcData);
+  if (bRet)
+  {
+    mdz_ext_scanWindow(pScan, pcData, nLeftPos, nLeftPos, nRightPos + 1 - nCount);
+  }
+
+  free(pcData);
+  return bRet;
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+struct mdz_ansi_compressed* mdz_ansi_compressedCreate(const struct mdz_Ansi* pAnsi, size_t nBlockSize)
+{
+  struct mdz_ext_compressContext oContext;
+  struct mdz_ansi_compressed* pCompressed;
+  const unsigned char* pcData;
+  size_t nSize;
+  size_t nBorder;
+  size_t nSeamEnd;
+  size_t nPairBits;
+  size_t i;
+
+  if (NULL == pAnsi)
+  {
+    return NULL;
+  }
+
+  if (0 == nBlockSize)
+  {
+    nBlockSize = MDZ_EXT_BLOCK_DEFAULT;
+  }
+
+  nSize = mdz_ansi_size(pAnsi);
+  if (0 == nSize || nBlockSize < MDZ_EXT_BLOCK_MIN)
+  {
+    return NULL;
+  }
+
+  pCompressed = (struct mdz_ansi_compressed*) malloc(sizeof(struct mdz_ansi_compressed));
+  if (NULL == pCompressed)
+  {
+    return NULL;
+  }
+
+  pCompressed->m_nSize = nSize;
+  pCompressed->m_nBlockSize = nBlockSize;
+  pCompressed->m_nBlocks = (nSize - 1) / nBlockSize + 1;
+
+  pCompressed->m_nPairShift = 32 - 8;
+  for (nPairBits = MDZ_EXT_PAIR_BITS_MIN; nPairBits < MDZ_EXT_PAIR_BITS && nPairBits * 4 <= nBlockSize; nPairBits *= 2)
+  {
+    --pCompressed->m_nPairShift;
+  }
+
+  pCompressed->m_nPairBytes = nPairBits / 8;
+
+  pCompressed->m_pBlocks = (struct mdz_ext_block*) calloc(pCompressed->m_nBlocks, sizeof(struct mdz_ext_block));
+  pCompressed->m_pcPairs = (unsigned char*) malloc(pCompressed->m_nPairBytes * pCompressed->m_nBlocks);
+  pCompressed->m_pcSeams = (unsigned char*) malloc(2 * MDZ_EXT_SEAM * pCompressed->m_nBlocks);
+
+  if (NULL == pCompressed->m_pBlocks || NULL == pCompressed->m_pcPairs || NULL == pCompressed->m_pcSeams)
+  {
+    mdz_ansi_compressedDestroy(&pCompressed);
+    return NULL;
+  }
+
+  pcData = (const unsigned char*) pAnsi->m_pData;
+
+  oContext.m_pcData = pcData;
+  oContext.m_pCompressed = pCompressed;
+  oContext.m_bFailed = mdz_false;
+
+  mdz_ext_processRange(nSize, nBlockSize, mdz_ext_compressRange, &oContext, NULL);
+
+  if (oContext.m_bFailed)
+  {
+    mdz_ansi_compressedDestroy(&pCompressed);
+    return NULL;
+  }
+
+  for (i = 0; i + 1 < pCompressed->m_nBlocks; ++i)
+  {
+    nBorder = (i + 1) * nBlockSize;
+    nSeamEnd = (nSize - nBorder < MDZ_EXT_SEAM) ? nSize : nBorder + MDZ_EXT_SEAM;
+    memcpy(pCompressed->m_pcSeams + 2 * MDZ_EXT_SEAM * i, pcData + nBorder - MDZ_EXT_SEAM, nSeamEnd - (nBorder - MDZ_EXT_SEAM));
+  }
+
+  return pCompressed;
+}
+
+void mdz_ansi_compressedDestroy(struct mdz_ansi_compressed** ppCompressed)
+{
+  struct mdz_ansi_compressed* pCompressed;
+  size_t i;
+
+  if (NULL == ppCompressed || NULL == *ppCompressed)
+  {
+    return;
+  }
+
+  pCompressed = *ppCompressed;
+
+  if (NULL != pCompressed->m_pBlocks)
+  {
+    for (i = 0; i < pCompressed->m_nBlocks; ++i)
+    {
+      free(pCompressed->m_pBlocks[i].m_pcData);
+    }
+
+    free(pCompressed->m_pBlocks);
+  }
+
+  free(pCompressed->m_pcPairs);
+  free(pCompressed->m_pcSeams);
+  free(pCompressed);
+
+  *ppCompressed = NULL;
+}
+
+size_t mdz_ansi_compressedSize(const struct mdz_ansi_compressed* pCompressed)
+{
+  return (NULL != pCompressed) ? pCompressed->m_nSize : 0;
+}
+
+size_t mdz_ansi_compressedMemory(const struct mdz_ansi_compressed* pCompressed)
+{
+  size_t nMemory;
+  size_t i;
+
+  if (NULL == pCompressed)
+  {
+    return 0;
+  }
+
+  nMemory = sizeof(struct mdz_ansi_compressed) + pCompressed->m_nBlocks * (sizeof(struct mdz_ext_block) + pCompressed->m_nPairBytes + 2 * MDZ_EXT_SEAM);
+  for (i = 0; i < pCompressed->m_nBlocks; ++i)
+  {
+    nMemory += pCompressed->m_pBlocks[i].m_nSize;
+  }
+
+  return nMemory;
+}
+
+mdz_bool mdz_ansi_compressedCopy(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi)
+{
+  size_t nSize;
+
+  if (NULL == pCompressed || NULL == pSubAnsi)
+  {
+    return mdz_false;
+  }
+
+  if (SIZE_MAX == nRightPos)
+  {
+    nRightPos = pCompressed->m_nSize - 1;
+  }
+
+  if (nLeftPos > nRightPos || nRightPos >= pCompressed->m_nSize)
+  {
+    return mdz_false;
+  }
+
+  nSize = nRightPos - nLeftPos + 1;
+
+  mdz_ansi_clear(pSubAnsi);
+  if (!mdz_ansi_reserve(pSubAnsi, nSize + 1))
+  {
+    return mdz_false;
+  }
+
+  if (!mdz_ext_decompress(pCompressed, nLeftPos, nRightPos + 1, (unsigned char*) pSubAnsi->m_pData))
+  {
+    return mdz_false;
+  }
+
+  return mdz_ansi_resize(pSubAnsi, nSize);
+}
+
+size_t mdz_ansi_compressedFind(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount)
+{
+  struct mdz_ext_scan oScan;
+
+  if (NULL == pCompressed)
+  {
+    return SIZE_MAX;
+  }
+
+  oScan.m_bCount = mdz_false;
+  oScan.m_bAllowOverlapped = mdz_false;
+
+  if (!mdz_ext_compressedScan(pCompressed, nLeftPos, nRightPos, pcItems, nCount, &oScan))
+  {
+    return SIZE_MAX;
+  }
+
+  return oScan.m_nFound;
+}
+
+size_t mdz_ansi_compressedCount(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped)
+{
+  struct mdz_ext_scan oScan;
+
+  if (NULL == pCompressed)
+  {
+    return SIZE_MAX;
+  }
+
+  oScan.m_bCount = mdz_true;
+  oScan.m_bAllowOverlapped = bAllowOverlapped;
+
+  if (!mdz_ext_compressedScan(pCompressed, nLeftPos, nRightPos, pcItems, nCount, &oScan))
+  {
+    return SIZE_MAX;
+  }
+
+  return oScan.m_nTotal;
+}
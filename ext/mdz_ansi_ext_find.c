@@ -0,0 +1,408 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Find kernels of mdz_ansi_ext. Forward search of single items uses memchr(), reverse search compares 16 (SSE2) or 32 (AVX2) items at once.
+ * Sub-strings are searched in both directions comparing first and last items of sub-string with 16 (SSE2) or 32 (AVX2) positions at once,
+ * candidates are verified using memcmp(). Thus forward and reverse searches have the same speed.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+static size_t mdz_ext_findScalar(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  const unsigned char* pcFound;
+  size_t nPos = 0;
+  size_t nLast = nSize - nCount;
+
+  while (nPos <= nLast)
+  {
+    pcFound = (const unsigned char*) memchr(pcData + nPos, pcItems[0], nLast - nPos + 1);
+    if (NULL == pcFound)
+    {
+      break;
+    }
+
+    nPos = (size_t) (pcFound - pcData);
+
+    if (pcData[nPos + nCount - 1] == pcItems[nCount - 1] && 0 == memcmp(pcData + nPos + 1, pcItems + 1, nCount - 1))
+    {
+      return nPos;
+    }
+
+    ++nPos;
+  }
+
+  return nSize;
+}
+
+static size_t mdz_ext_findSingle(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  const unsigned char* pcFound = (const unsigned char*) memchr(pcData, pcItems[0], nSize);
+
+  (void) nCount;
+
+  return (NULL != pcFound) ? (size_t) (pcFound - pcData) : nSize;
+}
+
+static size_t mdz_ext_rfindSingleScalar(const unsigned char* pcData, size_t nSize, unsigned char cItem)
+{
+  size_t i = nSize;
+
+  for (; i > 0; --i)
+  {
+    if (pcData[i - 1] == cItem)
+    {
+      return i - 1;
+    }
+  }
+
+  return nSize;
+}
+
+static size_t mdz_ext_rfindScalar(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  size_t i = nSize - nCount + 1;
+
+  for (; i > 0; --i)
+  {
+    if (pcData[i - 1] == pcItems[0] && pcData[i + nCount - 2] == pcItems[nCount - 1] && 0 == memcmp(pcData + i, pcItems + 1, nCount - 1))
+    {
+      return i - 1;
+    }
+  }
+
+  return nSize;
+}
+
+#ifdef MDZ_EXT_SSE2
+static size_t mdz_ext_findSse2(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  const __m128i xFirst = _mm_set1_epi8((char) pcItems[0]);
+  const __m128i xLast = _mm_set1_epi8((char) pcItems[nCount - 1]);
+  unsigned int nMask;
+  size_t nFound;
+  size_t i = 0;
+
+  for (; i + nCount - 1 + 16 <= nSize; i += 16)
+  {
+    nMask = (unsigned int) _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(xFirst, _mm_loadu_si128((const __m128i*) (pcData + i))),
+                                                           _mm_cmpeq_epi8(xLast, _mm_loadu_si128((const __m128i*) (pcData + i + nCount - 1)))));
+    while (0 != nMask)
+    {
+      nFound = i + mdz_ext_ctz32(nMask);
+      if (0 == memcmp(pcData + nFound + 1, pcItems + 1, nCount - 2))
+      {
+        return nFound;
+      }
+      nMask &= nMask - 1;
+    }
+  }
+
+  nFound = mdz_ext_findScalar(pcData + i, nSize - i, pcItems, nCount);
+  return (nFound < nSize - i) ? i + nFound : nSize;
+}
+
+static size_t mdz_ext_rfindSingleSse2(const unsigned char* pcData, size_t nSize, unsigned char cItem)
+{
+  const __m128i xItem = _mm_set1_epi8((char) cItem);
+  unsigned int nMask;
+  size_t nFound;
+  size_t i = nSize;
+
+  for (; i >= 16; i -= 16)
+  {
+    nMask = (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(xItem, _mm_loadu_si128((const __m128i*) (pcData + i - 16))));
+    if (0 != nMask)
+    {
+      return i - 16 + 31 - mdz_ext_clz32(nMask);
+    }
+  }
+
+  nFound = mdz_ext_rfindSingleScalar(pcData, i, cItem);
+  return (nFound < i) ? nFound : nSize;
+}
+
+static size_t mdz_ext_rfindSse2(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  const __m128i xFirst = _mm_set1_epi8((char) pcItems[0]);
+  const __m128i xLast = _mm_set1_epi8((char) pcItems[nCount - 1]);
+  unsigned int nMask;
+  size_t nFound;
+  size_t i = nSize - nCount + 1;
+
+  /* i is the end of block of 16 candidate positions */
+  for (; i >= 16; i -= 16)
+  {
+    nMask = (unsigned int) _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(xFirst, _mm_loadu_si128((const __m128i*) (pcData + i - 16))),
+                                                           _mm_cmpeq_epi8(xLast, _mm_loadu_si128((const __m128i*) (pcData + i - 16 + nCount - 1)))));
+    while (0 != nMask)
+    {
+      nFound = i - 16 + 31 - mdz_ext_clz32(nMask);
+      if (0 == memcmp(pcData + nFound + 1, pcItems + 1, nCount - 2))
+      {
+        return nFound;
+      }
+      nMask &= ~(1u << (nFound - (i - 16)));
+    }
+  }
+
+  nFound = mdz_ext_rfindScalar(pcData, i + nCount - 1, pcItems, nCount);
+  return (nFound < i + nCount - 1) ? nFound : nSize;
+}
+#endif
+
+#ifdef MDZ_EXT_AVX2
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_findAvx2(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  const __m256i yFirst = _mm256_set1_epi8((char) pcItems[0]);
+  const __m256i yLast = _mm256_set1_epi8((char) pcItems[nCount - 1]);
+  unsigned int nMask;
+  size_t nFound;
+  size_t i = 0;
+
+  for (; i + nCount - 1 + 32 <= nSize; i += 32)
+  {
+    nMask = (unsigned int) _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(yFirst, _mm256_loadu_si256((const __m256i*) (pcData + i))),
+                                                                 _mm256_cmpeq_epi8(yLast, _mm256_loadu_si256((const __m256i*) (pcData + i + nCount - 1)))));
+    while (0 != nMask)
+    {
+      nFound = i + mdz_ext_ctz32(nMask);
+      if (0 == memcmp(pcData + nFound + 1, pcItems + 1, nCount - 2))
+      {
+        return nFound;
+      }
+      nMask &= nMask - 1;
+    }
+  }
+
+  nFound = mdz_ext_findScalar(pcData + i, nSize - i, pcItems, nCount);
+  return (nFound < nSize - i) ? i + nFound : nSize;
+}
+
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_rfindSingleAvx2(const unsigned char* pcData, size_t nSize, unsigned char cItem)
+{
+  const __m256i yItem = _mm256_set1_epi8((char) cItem);
+  unsigned int nMask;
+  size_t nFound;
+  size_t i = nSize;
+
+  for (; i >= 32; i -= 32)
+  {
+    nMask = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(yItem, _mm256_loadu_si256((const __m256i*) (pcData + i - 32))));
+    if (0 != nMask)
+    {
+      return i - 32 + 31 - mdz_ext_clz32(nMask);
+    }
+  }
+
+  nFound = mdz_ext_rfindSingleScalar(pcData, i, cItem);
+  return (nFound < i) ? nFound : nSize;
+}
+
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_rfindAvx2(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  const __m256i yFirst = _mm256_set1_epi8((char) pcItems[0]);
+  const __m256i yLast = _mm256_set1_epi8((char) pcItems[nCount - 1]);
+  unsigned int nMask;
+  size_t nFound;
+  size_t i = nSize - nCount + 1;
+
+  for (; i >= 32; i -= 32)
+  {
+    nMask = (unsigned int) _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(yFirst, _mm256_loadu_si256((const __m256i*) (pcData + i - 32))),
+                                                                 _mm256_cmpeq_epi8(yLast, _mm256_loadu_si256((const __m256i*) (pcData + i - 32 + nCount - 1)))));
+    while (0 != nMask)
+    {
+      nFound = i - 32 + 31 - mdz_ext_clz32(nMask);
+      if (0 == memcmp(pcData + nFound + 1, pcItems + 1, nCount - 2))
+      {
+        return nFound;
+      }
+      nMask &= ~(1u << (nFound - (i - 32)));
+    }
+  }
+
+  nFound = mdz_ext_rfindScalar(pcData, i + nCount - 1, pcItems, nCount);
+  return (nFound < i + nCount - 1) ? nFound : nSize;
+}
+#endif
+
+enum mdz_ansi_stats_kernel mdz_ext_findKernel(size_t nSize, size_t nCount, mdz_bool bReverse)
+{
+#ifndef MDZ_EXT_SSE2
+  (void) nSize;
+#endif
+
+  if (1 == nCount)
+  {
+    /* forward search of single item is done with memchr() */
+    if (!bReverse)
+    {
+      return MDZ_ANSI_STATS_KERNEL_SCALAR;
+    }
+
+#ifdef MDZ_EXT_AVX2
+    if (nSize >= 64 && mdz_ext_hasAvx2())
+    {
+      return MDZ_ANSI_STATS_KERNEL_AVX2;
+    }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+    return MDZ_ANSI_STATS_KERNEL_SSE2;
+#else
+    return MDZ_ANSI_STATS_KERNEL_SCALAR;
+#endif
+  }
+
+#ifdef MDZ_EXT_AVX2
+  if (nSize - nCount >= 64 && mdz_ext_hasAvx2())
+  {
+    return MDZ_ANSI_STATS_KERNEL_AVX2;
+  }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+  if (nSize - nCount >= 32)
+  {
+    return MDZ_ANSI_STATS_KERNEL_SSE2;
+  }
+#endif
+
+  return MDZ_ANSI_STATS_KERNEL_SCALAR;
+}
+
+mdz_ext_findFunc mdz_ext_findSelect(size_t nSize, size_t nCount)
+{
+  if (1 == nCount)
+  {
+    return mdz_ext_findSingle;
+  }
+
+  switch (mdz_ext_findKernel(nSize, nCount, mdz_false))
+  {
+#ifdef MDZ_EXT_AVX2
+  case MDZ_ANSI_STATS_KERNEL_AVX2:
+    return mdz_ext_findAvx2;
+#endif
+#ifdef MDZ_EXT_SSE2
+  case MDZ_ANSI_STATS_KERNEL_SSE2:
+    return mdz_ext_findSse2;
+#endif
+  default:
+    return mdz_ext_findScalar;
+  }
+}
+
+size_t mdz_ext_findData(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  if (nCount > nSize)
+  {
+    return nSize;
+  }
+
+  return mdz_ext_findSelect(nSize, nCount)(pcData, nSize, pcItems, nCount);
+}
+
+size_t mdz_ext_rfindData(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount)
+{
+  if (nCount > nSize)
+  {
+    return nSize;
+  }
+
+  switch (mdz_ext_findKernel(nSize, nCount, mdz_true))
+  {
+#ifdef MDZ_EXT_AVX2
+  case MDZ_ANSI_STATS_KERNEL_AVX2:
+    return (1 == nCount) ? mdz_ext_rfindSingleAvx2(pcData, nSize, pcItems[0]) : mdz_ext_rfindAvx2(pcData, nSize, pcItems, nCount);
+#endif
+#ifdef MDZ_EXT_SSE2
+  case MDZ_ANSI_STATS_KERNEL_SSE2:
+    return (1 == nCount) ? mdz_ext_rfindSingleSse2(pcData, nSize, pcItems[0]) : mdz_ext_rfindSse2(pcData, nSize, pcItems, nCount);
+#endif
+  default:
+    return (1 == nCount) ? mdz_ext_rfindSingleScalar(pcData, nSize, pcItems[0]) : mdz_ext_rfindScalar(pcData, nSize, pcItems, nCount);
+  }
+}
+
+size_t mdz_ext_findRange(const unsigned char* pcData, size_t nFrom, size_t nTo, const unsigned char* pcItems, size_t nCount, mdz_bool bReverse, const struct mdz_asyncData* pAsyncData, mdz_bool* pbCancelled)
+{
+  size_t nWindow = (NULL == pAsyncData) ? nTo - nFrom : MDZ_ANSI_EXT_CANCEL_CHUNK + nCount - 1;
+  mdz_ext_findFunc pfnFind;
+  size_t nStart;
+  size_t nEnd;
+  size_t nFound;
+
+  *pbCancelled = mdz_false;
+
+  if (nCount > nTo - nFrom)
+  {
+    return nTo;
+  }
+
+  mdz_ext_statsKernel(mdz_ext_findKernel(nTo - nFrom, nCount, bReverse));
+
+  /* windows overlap on nCount-1 items, thus occurrences on window borders are found */
+  if (!bReverse)
+  {
+    /* every window has at least nCount items, thus kernel selected for the whole range is used for all windows */
+    pfnFind = mdz_ext_findSelect(nTo - nFrom, nCount);
+
+    for (nStart = nFrom; nTo - nStart >= nCount; nStart = nEnd - (nCount - 1))
+    {
+      if (mdz_ext_isCancelled(pAsyncData))
+      {
+        *pbCancelled = mdz_true;
+        return nStart;
+      }
+
+      nEnd = (nTo - nStart > nWindow) ? nStart + nWindow : nTo;
+      nFound = pfnFind(pcData + nStart, nEnd - nStart, pcItems, nCount);
+      if (nFound < nEnd - nStart)
+      {
+        return nStart + nFound;
+      }
+
+      if (nEnd == nTo)
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    for (nEnd = nTo; nEnd - nFrom >= nCount; nEnd = nStart + (nCount - 1))
+    {
+      if (mdz_ext_isCancelled(pAsyncData))
+      {
+        *pbCancelled = mdz_true;
+        return nEnd;
+      }
+
+      nStart = (nEnd - nFrom > nWindow) ? nEnd - nWindow : nFrom;
+      nFound = mdz_ext_rfindData(pcData + nStart, nEnd - nStart, pcItems, nCount);
+      if (nFound < nEnd - nStart)
+      {
+        return nStart + nFound;
+      }
+
+      if (nStart == nFrom)
+      {
+        break;
+      }
+    }
+  }
+
+  return nTo;
+}
@@ -0,0 +1,577 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Histogram functions of mdz_ansi_ext: counting of all byte values, or of chosen bytes, in one pass over range. Ranges from MDZ_ANSI_EXT_PARALLEL_THRESHOLD bytes
+ * are split between threads, counts of threads are added into result atomically.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+#ifdef _WIN32
+#ifdef _WIN64
+#define mdz_ext_fetchAdd(pnTarget, nValue) ((size_t) InterlockedExchangeAdd64((volatile LONG64*) (pnTarget), (LONG64) (nValue)))
+#else
+#define mdz_ext_fetchAdd(pnTarget, nValue) ((size_t) InterlockedExchangeAdd((volatile LONG*) (pnTarget), (LONG) (nValue)))
+#endif
+#else
+#define mdz_ext_fetchAdd(pnTarget, nValue) __sync_fetch_and_add((pnTarget), (nValue))
+#endif
+
+/**
+ * Number of interleaved sub-histograms. Neighbour bytes are counted in different sub-histograms, thus increments of the same counter (in runs of equal bytes)
+ * do not wait for each other through store-to-load forwarding
+ */
+#define MDZ_EXT_HISTOGRAM_WAYS 4
+
+/**
+ * Sub-histograms have 32-bit counters, which are added into totals after this number of bytes
+ */
+#define MDZ_EXT_HISTOGRAM_FLUSH (1024 * 1024 * 1024)
+
+/**
+ * Ranges shorter than this are counted directly into totals, without clearing and summing of sub-histograms
+ */
+#define MDZ_EXT_HISTOGRAM_SMALL 1024
+
+/**
+ * Maximal number of different bytes counted with SIMD comparisons. Larger sets are counted with histogram
+ */
+#define MDZ_EXT_COUNT_SIMD_ITEMS 8
+
+/**
+ * \defgroup Counting kernels. Add counts of bytes in [pcData, pcData + nSize) to pnCounts
+ */
+
+static void mdz_ext_histogramScalar(const unsigned char* pcData, size_t nSize, size_t* pnCounts)
+{
+  uint32_t aWays[MDZ_EXT_HISTOGRAM_WAYS][256];
+  uint32_t nWord0;
+  uint32_t nWord1;
+  size_t nBlock;
+  size_t i;
+
+  if (nSize < MDZ_EXT_HISTOGRAM_SMALL)
+  {
+    for (i = 0; i < nSize; ++i)
+    {
+      ++pnCounts[pcData[i]];
+    }
+    return;
+  }
+
+  while (nSize > 0)
+  {
+    nBlock = (nSize > MDZ_EXT_HISTOGRAM_FLUSH) ? MDZ_EXT_HISTOGRAM_FLUSH : nSize;
+    memset(aWays, 0, sizeof(aWays));
+
+    /* byte order of words does not matter: every byte of word is counted in its own sub-histogram */
+    for (i = 0; i + 8 <= nBlock; i += 8)
+    {
+      memcpy(&nWord0, pcData + i, 4);
+      memcpy(&nWord1, pcData + i + 4, 4);
+
+      ++aWays[0][nWord0 & 0xFF];
+      ++aWays[1][(nWord0 >> 8) & 0xFF];
+      ++aWays[2][(nWord0 >> 16) & 0xFF];
+      ++aWays[3][nWord0 >> 24];
+      ++aWays[0][nWord1 & 0xFF];
+      ++aWays[1][(nWord1 >> 8) & 0xFF];
+      ++aWays[2][(nWord1 >> 16) & 0xFF];
+      ++aWays[3][nWord1 >> 24];
+    }
+
+    for (; i < nBlock; ++i)
+    {
+      ++aWays[i & (MDZ_EXT_HISTOGRAM_WAYS - 1)][pcData[i]];
+    }
+
+    for (i = 0; i < 256; ++i)
+    {
+      pnCounts[i] += (size_t) aWays[0][i] + aWays[1][i] + aWays[2][i] + aWays[3][i];
+    }
+
+    pcData += nBlock;
+    nSize -= nBlock;
+  }
+}
+
+#if defined(MDZ_EXT_SSE2) || defined(MDZ_EXT_AVX2)
+static void mdz_ext_countItemsScalar(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nItems, size_t* pnCounts)
+{
+  size_t i;
+  size_t j;
+
+  for (i = 0; i < nSize; ++i)
+  {
+    for (j = 0; j < nItems; ++j)
+    {
+      if (pcData[i] == pcItems[j])
+      {
+        ++pnCounts[j];
+        break;
+      }
+    }
+  }
+}
+#endif
+
+#ifdef MDZ_EXT_SSE2
+/**
+ * 8-bit accumulators are decremented by comparison masks (-1 on match) of 4 vectors per iteration, thus 63 iterations do not overflow them. Then they are summed with psadbw
+ */
+static void mdz_ext_countItemsSse2(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nItems, size_t* pnCounts)
+{
+  __m128i aItems[MDZ_EXT_COUNT_SIMD_ITEMS];
+  __m128i aAcc[MDZ_EXT_COUNT_SIMD_ITEMS];
+  const __m128i xZero = _mm_setzero_si128();
+  __m128i xData0;
+  __m128i xData1;
+  __m128i xData2;
+  __m128i xData3;
+  __m128i xAcc;
+  size_t nBlock;
+  size_t i = 0;
+  size_t j;
+
+  for (j = 0; j < nItems; ++j)
+  {
+    aItems[j] = _mm_set1_epi8((char) pcItems[j]);
+  }
+
+  while (nSize - i >= 64)
+  {
+    nBlock = (nSize - i) / 64;
+    if (nBlock > 63)
+    {
+      nBlock = 63;
+    }
+
+    for (j = 0; j < nItems; ++j)
+    {
+      aAcc[j] = xZero;
+    }
+
+    for (; nBlock > 0; --nBlock, i += 64)
+    {
+      xData0 = _mm_loadu_si128((const __m128i*) (pcData + i));
+      xData1 = _mm_loadu_si128((const __m128i*) (pcData + i + 16));
+      xData2 = _mm_loadu_si128((const __m128i*) (pcData + i + 32));
+      xData3 = _mm_loadu_si128((const __m128i*) (pcData + i + 48));
+
+      for (j = 0; j < nItems; ++j)
+      {
+        xAcc = _mm_sub_epi8(aAcc[j], _mm_cmpeq_epi8(xData0, aItems[j]));
+        xAcc = _mm_sub_epi8(xAcc, _mm_cmpeq_epi8(xData1, aItems[j]));
+        xAcc = _mm_sub_epi8(xAcc, _mm_cmpeq_epi8(xData2, aItems[j]));
+        aAcc[j] = _mm_sub_epi8(xAcc, _mm_cmpeq_epi8(xData3, aItems[j]));
+      }
+    }
+
+    for (j = 0; j < nItems; ++j)
+    {
+      xAcc = _mm_sad_epu8(aAcc[j], xZero);
+      pnCounts[j] += (size_t) _mm_cvtsi128_si32(xAcc) + (size_t) _mm_cvtsi128_si32(_mm_srli_si128(xAcc, 8));
+    }
+  }
+
+  mdz_ext_countItemsScalar(pcData + i, nSize - i, pcItems, nItems, pnCounts);
+}
+#endif
+
+#ifdef MDZ_EXT_AVX2
+MDZ_EXT_TARGET_AVX2
+static void mdz_ext_countItemsAvx2(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nItems, size_t* pnCounts)
+{
+  __m256i aItems[MDZ_EXT_COUNT_SIMD_ITEMS];
+  __m256i aAcc[MDZ_EXT_COUNT_SIMD_ITEMS];
+  const __m256i yZero = _mm256_setzero_si256();
+  __m256i yData0;
+  __m256i yData1;
+  __m256i yData2;
+  __m256i yData3;
+  __m256i yAcc;
+  __m128i xSum;
+  size_t nBlock;
+  size_t i = 0;
+  size_t j;
+
+  for (j = 0; j < nItems; ++j)
+  {
+    aItems[j] = _mm256_set1_epi8((char) pcItems[j]);
+  }
+
+  while (nSize - i >= 128)
+  {
+    nBlock = (nSize - i) / 128;
+    if (nBlock > 63)
+    {
+      nBlock = 63;
+    }
+
+    for (j = 0; j < nItems; ++j)
+    {
+      aAcc[j] = yZero;
+    }
+
+    for (; nBlock > 0; --nBlock, i += 128)
+    {
+      yData0 = _mm256_loadu_si256((const __m256i*) (pcData + i));
+      yData1 = _mm256_loadu_si256((const __m256i*) (pcData + i + 32));
+      yData2 = _mm256_loadu_si256((const __m256i*) (pcData + i + 64));
+      yData3 = _mm256_loadu_si256((const __m256i*) (pcData + i + 96));
+
+      for (j = 0; j < nItems; ++j)
+      {
+        yAcc = _mm256_sub_epi8(aAcc[j], _mm256_cmpeq_epi8(yData0, aItems[j]));
+        yAcc = _mm256_sub_epi8(yAcc, _mm256_cmpeq_epi8(yData1, aItems[j]));
+        yAcc = _mm256_sub_epi8(yAcc, _mm256_cmpeq_epi8(yData2, aItems[j]));
+        aAcc[j] = _mm256_sub_epi8(yAcc, _mm256_cmpeq_epi8(yData3, aItems[j]));
+      }
+    }
+
+    for (j = 0; j < nItems; ++j)
+    {
+      yAcc = _mm256_sad_epu8(aAcc[j], yZero);
+      xSum = _mm_add_epi32(_mm256_castsi256_si128(yAcc), _mm256_extracti128_si256(yAcc, 1));
+      pnCounts[j] += (size_t) _mm_cvtsi128_si32(xSum) + (size_t) _mm_cvtsi128_si32(_mm_srli_si128(xSum, 8));
+    }
+  }
+
+  mdz_ext_countItemsScalar(pcData + i, nSize - i, pcItems, nItems, pnCounts);
+}
+#endif
+
+/**
+ * Kernel for counting of nItems different bytes (0 - all bytes) in range of nSize bytes
+ */
+static enum mdz_ansi_stats_kernel mdz_ext_countKernel(size_t nSize, size_t nItems)
+{
+#ifndef MDZ_EXT_AVX2
+  (void) nSize;
+#endif
+
+  if (0 == nItems || nItems > MDZ_EXT_COUNT_SIMD_ITEMS)
+  {
+    return MDZ_ANSI_STATS_KERNEL_SCALAR;
+  }
+
+#ifdef MDZ_EXT_AVX2
+  if (nSize >= 128 && mdz_ext_hasAvx2())
+  {
+    return MDZ_ANSI_STATS_KERNEL_AVX2;
+  }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+  return MDZ_ANSI_STATS_KERNEL_SSE2;
+#else
+  return MDZ_ANSI_STATS_KERNEL_SCALAR;
+#endif
+}
+
+struct mdz_ext_histogramContext
+{
+  const unsigned char* m_pcData;
+
+  /**
+   * Different bytes counted with SIMD comparisons. If m_nItems == 0, all bytes are counted
+   */
+  unsigned char m_aItems[MDZ_EXT_COUNT_SIMD_ITEMS];
+  size_t m_nItems;
+
+  /**
+   * Counts of m_aItems, or of all 256 bytes if m_nItems == 0
+   */
+  size_t* m_pnCounts;
+};
+
+/**
+ * Add counts of bytes in [pcData, pcData + nSize) to pnCounts
+ */
+static void mdz_ext_countBytes(const struct mdz_ext_histogramContext* pContext, const unsigned char* pcData, size_t nSize, size_t* pnCounts)
+{
+  switch (mdz_ext_countKernel(nSize, pContext->m_nItems))
+  {
+#ifdef MDZ_EXT_AVX2
+  case MDZ_ANSI_STATS_KERNEL_AVX2:
+    mdz_ext_countItemsAvx2(pcData, nSize, pContext->m_aItems, pContext->m_nItems, pnCounts);
+    break;
+#endif
+#ifdef MDZ_EXT_SSE2
+  case MDZ_ANSI_STATS_KERNEL_SSE2:
+    mdz_ext_countItemsSse2(pcData, nSize, pContext->m_aItems, pContext->m_nItems, pnCounts);
+    break;
+#endif
+  default:
+#if defined(MDZ_EXT_SSE2) || defined(MDZ_EXT_AVX2)
+    /* short chunk of range, which is counted with AVX2 only */
+    if (pContext->m_nItems > 0)
+    {
+      mdz_ext_countItemsScalar(pcData, nSize, pContext->m_aItems, pContext->m_nItems, pnCounts);
+      break;
+    }
+#endif
+    mdz_ext_histogramScalar(pcData, nSize, pnCounts);
+    break;
+  }
+}
+
+static void mdz_ext_histogramRange(void* pContext, size_t nFrom, size_t nTo)
+{
+  struct mdz_ext_histogramContext* pHistogram = (struct mdz_ext_histogramContext*) pContext;
+  size_t aCounts[256];
+  size_t nCounts = (0 == pHistogram->m_nItems) ? 256 : pHistogram->m_nItems;
+  size_t i;
+
+  /* chunk is counted locally, thus threads touch shared counts only once per chunk */
+  memset(aCounts, 0, nCounts * sizeof(size_t));
+  mdz_ext_countBytes(pHistogram, pHistogram->m_pcData + nFrom, nTo - nFrom, aCounts);
+
+  for (i = 0; i < nCounts; ++i)
+  {
+    if (aCounts[i] > 0)
+    {
+      mdz_ext_fetchAdd(&pHistogram->m_pnCounts[i], aCounts[i]);
+    }
+  }
+}
+
+/**
+ * Count bytes of range [nLeftPos, nLeftPos + nSize) into pContext->m_pnCounts, which must be zeroed. Return number of counted bytes (see mdz_ext_processRange())
+ */
+static size_t mdz_ext_histogramData(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nSize, struct mdz_ext_histogramContext* pContext, const struct mdz_asyncData* pAsyncData)
+{
+  pContext->m_pcData = (const unsigned char*) pAnsi->m_pData + nLeftPos;
+
+  mdz_ext_statsKernel(mdz_ext_countKernel(nSize, pContext->m_nItems));
+
+  /* range for one thread is counted directly into result */
+  if (NULL == pAsyncData && nSize < MDZ_ANSI_EXT_PARALLEL_THRESHOLD)
+  {
+    mdz_ext_countBytes(pContext, pContext->m_pcData, nSize, pContext->m_pnCounts);
+    return nSize;
+  }
+
+  return mdz_ext_processRange(nSize, 64, mdz_ext_histogramRange, pContext, pAsyncData);
+}
+
+static mdz_bool mdz_ext_histogram(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, size_t* pnCounts, const struct mdz_asyncData* pAsyncData, size_t* pnResume)
+{
+  struct mdz_ext_histogramContext oContext;
+  size_t nSize;
+  size_t nDone;
+
+  if (NULL == pnCounts)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_DATA);
+    return mdz_true;
+  }
+
+  memset(pnCounts, 0, 256 * sizeof(size_t));
+
+  if (!mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  nSize = nRightPos - nLeftPos + 1;
+
+  oContext.m_nItems = 0;
+  oContext.m_pnCounts = pnCounts;
+
+  nDone = mdz_ext_histogramData(pAnsi, nLeftPos, nSize, &oContext, pAsyncData);
+  if (nDone < nSize)
+  {
+    *pnResume = nLeftPos + nDone;
+  }
+
+  return mdz_true;
+}
+
+static mdz_bool mdz_ext_countAnyOf(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnCounts, const struct mdz_asyncData* pAsyncData,
+                                   size_t* pnResume)
+{
+  struct mdz_ext_histogramContext oContext;
+  unsigned char aSlots[256];
+  size_t aCounts[256];
+  size_t nSize;
+  size_t nDone;
+  size_t i;
+
+  if (!mdz_ext_checkItems(pAnsi, pcItems, &nCount))
+  {
+    return mdz_true;
+  }
+
+  if (NULL == pnCounts)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_DATA);
+    return mdz_true;
+  }
+
+  memset(pnCounts, 0, nCount * sizeof(size_t));
+
+  if (!mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  nSize = nRightPos - nLeftPos + 1;
+
+  /* repeated items share slot of their first occurrence. Up to MDZ_EXT_COUNT_SIMD_ITEMS different items are compared, otherwise the whole histogram is counted */
+  memset(aSlots, 0xFF, sizeof(aSlots));
+  oContext.m_nItems = 0;
+
+  for (i = 0; i < nCount && oContext.m_nItems <= MDZ_EXT_COUNT_SIMD_ITEMS; ++i)
+  {
+    if (0xFF == aSlots[(unsigned char) pcItems[i]])
+    {
+      if (oContext.m_nItems < MDZ_EXT_COUNT_SIMD_ITEMS)
+      {
+        oContext.m_aItems[oContext.m_nItems] = (unsigned char) pcItems[i];
+      }
+
+      aSlots[(unsigned char) pcItems[i]] = (unsigned char) oContext.m_nItems;
+      ++oContext.m_nItems;
+    }
+  }
+
+  if (MDZ_ANSI_STATS_KERNEL_SCALAR == mdz_ext_countKernel(nSize, oContext.m_nItems))
+  {
+    oContext.m_nItems = 0;
+  }
+
+  memset(aCounts, 0, sizeof(aCounts));
+  oContext.m_pnCounts = aCounts;
+
+  nDone = mdz_ext_histogramData(pAnsi, nLeftPos, nSize, &oContext, pAsyncData);
+  if (nDone < nSize)
+  {
+    *pnResume = nLeftPos + nDone;
+  }
+
+  for (i = 0; i < nCount; ++i)
+  {
+    pnCounts[i] = (0 == oContext.m_nItems) ? aCounts[(unsigned char) pcItems[i]] : aCounts[aSlots[(unsigned char) pcItems[i]]];
+  }
+
+  return mdz_true;
+}
+
+/**
+ * \defgroup Asynchronous calls
+ */
+
+struct mdz_ext_histogramArgs
+{
+  const struct mdz_Ansi* m_pAnsi;
+  size_t m_nLeftPos;
+  size_t m_nRightPos;
+  const char* m_pcItems;
+  size_t m_nCount;
+  size_t* m_pnCounts;
+};
+
+static struct mdz_ext_histogramArgs* mdz_ext_histogramArgsCreate(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnCounts)
+{
+  struct mdz_ext_histogramArgs* pArgs = (struct mdz_ext_histogramArgs*) malloc(sizeof(struct mdz_ext_histogramArgs));
+
+  if (NULL != pArgs)
+  {
+    pArgs->m_pAnsi = pAnsi;
+    pArgs->m_nLeftPos = nLeftPos;
+    pArgs->m_nRightPos = nRightPos;
+    pArgs->m_pcItems = pcItems;
+    pArgs->m_nCount = nCount;
+    pArgs->m_pnCounts = pnCounts;
+  }
+
+  return pArgs;
+}
+
+static mdz_bool mdz_ext_histogramAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_histogramArgs* pArgs = (struct mdz_ext_histogramArgs*) pParam;
+  size_t nResume = SIZE_MAX;
+  mdz_bool bRet = mdz_ext_histogram(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pnCounts, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = (SIZE_MAX == nResume) ? (size_t) bRet : nResume;
+  return (SIZE_MAX == nResume);
+}
+
+static mdz_bool mdz_ext_countAnyOfAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_histogramArgs* pArgs = (struct mdz_ext_histogramArgs*) pParam;
+  size_t nResume = SIZE_MAX;
+  mdz_bool bRet = mdz_ext_countAnyOf(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pcItems, pArgs->m_nCount, pArgs->m_pnCounts, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = (SIZE_MAX == nResume) ? (size_t) bRet : nResume;
+  return (SIZE_MAX == nResume);
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_histogram_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, size_t* pnCounts, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  size_t nResume;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_HISTOGRAM, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_histogramAsync, mdz_ext_histogramArgsCreate(pAnsi, nLeftPos, nRightPos, NULL, 0, pnCounts), &oStatsCall);
+  }
+
+  bRet = mdz_ext_histogram(pAnsi, nLeftPos, nRightPos, pnCounts, NULL, &nResume);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_countAnyOf_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnCounts, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  size_t nResume;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_COUNTANYOF, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_countAnyOfAsync, mdz_ext_histogramArgsCreate(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pnCounts), &oStatsCall);
+  }
+
+  bRet = mdz_ext_countAnyOf(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pnCounts, NULL, &nResume);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
@@ -0,0 +1,397 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Private declarations shared by mdz_ansi_ext source files: build configuration, range validation, CPU dispatch,
+ * threading helpers and byte-set kernels. Not part of public interface.
+ *
+ */
+
+#ifndef MDZ_ANSI_EXT_INTERNAL_H
+#define MDZ_ANSI_EXT_INTERNAL_H
+
+#include "mdz_ansi_ext.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * \defgroup Build configuration
+ */
+
+/**
+ * Minimal range size in bytes, from which processing is split between several threads
+ */
+#ifndef MDZ_ANSI_EXT_PARALLEL_THRESHOLD
+#define MDZ_ANSI_EXT_PARALLEL_THRESHOLD (8 * 1024 * 1024)
+#endif
+
+/**
+ * Maximal number of threads used for splitting of one call
+ */
+#ifndef MDZ_ANSI_EXT_MAX_THREADS
+#define MDZ_ANSI_EXT_MAX_THREADS 64
+#endif
+
+/**
+ * Size of chunk in bytes, after which asynchronous calls check m_bCancel
+ */
+#ifndef MDZ_ANSI_EXT_CANCEL_CHUNK
+#define MDZ_ANSI_EXT_CANCEL_CHUNK (256 * 1024)
+#endif
+
+/**
+ * Minimal size in bytes of bulk initialization/copying (see "Bulk functions"), from which non-temporal stores are used: written data bypasses cache.
+ * Should be larger than last-level cache
+ */
+#ifndef MDZ_ANSI_EXT_STREAM_THRESHOLD
+#define MDZ_ANSI_EXT_STREAM_THRESHOLD (16 * 1024 * 1024)
+#endif
+
+/**
+ * Define MDZ_ANSI_EXT_STATS to compile collecting of call statistics (see mdz_ansi_statsEnable()). Without it statistics functions return mdz_false and calls have no overhead
+ */
+
+/**
+ * \defgroup Platform detection
+ */
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MDZ_EXT_X86
+#endif
+
+/**
+ * Define MDZ_ANSI_EXT_NO_SIMD to build only portable kernels, MDZ_ANSI_EXT_NO_AVX2 to build without AVX2 kernels
+ */
+#ifdef MDZ_ANSI_EXT_NO_SIMD
+#define MDZ_ANSI_EXT_NO_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MDZ_EXT_SSE2
+#endif
+
+#if defined(MDZ_ANSI_EXT_NO_AVX2)
+#elif defined(MDZ_EXT_X86) && defined(__GNUC__) && (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define MDZ_EXT_AVX2
+#define MDZ_EXT_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(MDZ_EXT_X86) && defined(_MSC_VER) && _MSC_VER >= 1800
+#define MDZ_EXT_AVX2
+#define MDZ_EXT_TARGET_AVX2
+#endif
+
+#ifdef MDZ_EXT_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef MDZ_EXT_AVX2
+#include <immintrin.h>
+#endif
+
+/**
+ * Number of trailing/leading zero bits in non-zero 32-bit value
+ */
+#if defined(__GNUC__)
+#define mdz_ext_ctz32(nValue) ((unsigned int) __builtin_ctz(nValue))
+#define mdz_ext_clz32(nValue) ((unsigned int) __builtin_clz(nValue))
+#elif defined(_MSC_VER)
+unsigned int mdz_ext_ctz32(unsigned int nValue);
+unsigned int mdz_ext_clz32(unsigned int nValue);
+#endif
+
+/**
+ * \defgroup Validation
+ */
+
+/**
+ * Check pAnsi, nLeftPos and nRightPos of "range" function and set m_enErrorCode of pAnsi accordingly. nRightPos == SIZE_MAX is replaced with Size-1.
+ * \return:
+ * mdz_false - if range is invalid (MDZ_ERROR_BIGLEFT, MDZ_ERROR_BIGRIGHT). pAnsi must not be NULL
+ * mdz_true  - range is valid, *pnRightPos contains actual right position
+ */
+mdz_bool mdz_ext_checkRange(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t* pnRightPos);
+
+/**
+ * Check pcItems and nCount of "items" function and set m_enErrorCode of pAnsi accordingly. nCount == 0 is replaced with strlen(pcItems).
+ * \return:
+ * mdz_false - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT)
+ * mdz_true  - items are valid, *pnCount contains actual count
+ */
+mdz_bool mdz_ext_checkItems(const struct mdz_Ansi* pAnsi, const char* pcItems, size_t* pnCount);
+
+/**
+ * Check pSubAnsi of "copy" function and set m_enErrorCode of pAnsi accordingly.
+ * \return:
+ * mdz_false - if pSubAnsi == NULL or pSubAnsi == pAnsi (MDZ_ERROR_SUBCONTAINER)
+ * mdz_true  - pSubAnsi is valid
+ */
+mdz_bool mdz_ext_checkSubAnsi(const struct mdz_Ansi* pAnsi, struct mdz_Ansi* pSubAnsi);
+
+/**
+ * Set m_enErrorCode of pAnsi. pAnsi is const in "find" functions, but error code is still updated there
+ */
+#define mdz_ext_setError(pAnsi, enError) (((struct mdz_Ansi*) (pAnsi))->m_enErrorCode = (enError))
+
+/**
+ * \defgroup CPU dispatch
+ */
+
+/**
+ * Return mdz_true if AVX2 kernels may be used on current CPU/OS. Result is cached after first call
+ */
+mdz_bool mdz_ext_hasAvx2(void);
+
+/**
+ * Return number of online processors (at least 1)
+ */
+size_t mdz_ext_cpuCount(void);
+
+/**
+ * \defgroup Threading
+ */
+
+/**
+ * Processing function for sub-range [nFrom, nTo) of range
+ */
+typedef void (*mdz_ext_rangeFunc)(void* pContext, size_t nFrom, size_t nTo);
+
+/**
+ * Process range [0, nSize) calling pfnRange on sub-ranges. Range is split between several threads if nSize >= MDZ_ANSI_EXT_PARALLEL_THRESHOLD: threads claim chunks of
+ * MDZ_ANSI_EXT_CANCEL_CHUNK bytes (rounded up to multiple of nAlign) in increasing order. If pAsyncData is not NULL, m_bCancel is checked before every chunk on every thread.
+ * Processing is made on calling thread if threads cannot be started.
+ * \return:
+ * nSize  - if the whole range is processed
+ * Result - if processing was cancelled using pAsyncData->m_bCancel: range [0, Result) is processed, the rest is not touched
+ */
+size_t mdz_ext_processRange(size_t nSize, size_t nAlign, mdz_ext_rangeFunc pfnRange, void* pContext, const struct mdz_asyncData* pAsyncData);
+
+/**
+ * \defgroup Statistics
+ */
+
+/**
+ * Statistics of one call, started with mdz_ext_statsBegin() and finished with mdz_ext_statsEnd(). Is passed to mdz_ext_startAsync() and finished on thread of asynchronous call
+ */
+struct mdz_ext_statsCall
+{
+  const struct mdz_Ansi* m_pAnsi;
+  const struct mdz_Ansi* m_pDest;
+  enum mdz_ansi_stats_func m_enFunc;
+  size_t m_nBytes;
+  size_t m_nCapacity;
+  uint64_t m_nStart;
+  mdz_bool m_bActive;
+  mdz_bool m_bTimed;
+};
+
+#ifdef MDZ_ANSI_EXT_STATS
+/**
+ * Start statistics of call of enFunc on range [nLeftPos, nRightPos] of pAnsi. Capacity increase of pDest is counted as reallocation: pass NULL for calls which never increase Capacity,
+ * thus Capacity is not read. Nothing is done if statistics are disabled
+ */
+void mdz_ext_statsBegin(struct mdz_ext_statsCall* pCall, enum mdz_ansi_stats_func enFunc, const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const struct mdz_Ansi* pDest);
+
+/**
+ * Finish statistics of call started with mdz_ext_statsBegin() and add it into counters of current thread
+ */
+void mdz_ext_statsEnd(struct mdz_ext_statsCall* pCall, mdz_bool bAsync);
+
+/**
+ * Count selection of search/scan kernel
+ */
+void mdz_ext_statsKernel(enum mdz_ansi_stats_kernel enKernel);
+
+/**
+ * Count started thread for asynchronous call (bAsync == mdz_true) or worker thread
+ */
+void mdz_ext_statsThread(mdz_bool bAsync);
+
+/**
+ * Release counters of current thread for re-use by other threads. Called before exit of threads started by mdz_ansi_ext
+ */
+void mdz_ext_statsRelease(void);
+#else
+#define mdz_ext_statsBegin(pCall, enFunc, pAnsi, nLeftPos, nRightPos, pDest) ((pCall)->m_bActive = mdz_false)
+#define mdz_ext_statsEnd(pCall, bAsync) ((void) (pCall))
+#define mdz_ext_statsKernel(enKernel) ((void) 0)
+#define mdz_ext_statsThread(bAsync) ((void) 0)
+#define mdz_ext_statsRelease() ((void) 0)
+#endif
+
+/**
+ * Body of asynchronous call. pArgs is allocated by caller using malloc() and is freed after return. Should fill m_nResult/m_pData of pAsyncData
+ * \return:
+ * mdz_true  - if call is completely finished
+ * mdz_false - if call is cancelled
+ */
+typedef mdz_bool (*mdz_ext_asyncFunc)(void* pArgs, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Start asynchronous call of pfnAsync on new thread. Thread handle is stored in m_hThread of pAsyncData, m_bFinished is set after pfnAsync return.
+ * pArgs is freed if thread cannot be started. pCall is finished and completion is posted into queue of pAsyncData on thread of call (or immediately if thread cannot be started)
+ * \return:
+ * mdz_false - if pArgs == NULL (MDZ_ERROR_THREAD_ALLOC) or thread cannot be started (MDZ_ERROR_THREAD_START)
+ * mdz_true  - thread is started
+ */
+mdz_bool mdz_ext_startAsync(struct mdz_Ansi* pAnsi, struct mdz_asyncData* pAsyncData, mdz_ext_asyncFunc pfnAsync, void* pArgs, struct mdz_ext_statsCall* pCall);
+
+/**
+ * Move pAsyncData into completed list of queue, to which it was added with mdz_ansi_queueAdd(). Nothing is done if pAsyncData was not added.
+ * Is the last access of asynchronous call to pAsyncData. bStarted is mdz_false if thread of call was not started (thread is not joined then)
+ */
+void mdz_ext_queuePost(struct mdz_asyncData* pAsyncData, mdz_bool bStarted);
+
+/**
+ * \defgroup Scheduling
+ */
+
+/**
+ * Running asynchronous call in list of scheduler. Is a part of call data, thus needs no allocation
+ */
+struct mdz_ext_schedTask
+{
+  const struct mdz_asyncData* m_pAsyncData;
+  enum mdz_ansi_priority m_enPriority;
+
+  /**
+   * Absolute deadline in milliseconds of monotonic clock, or UINT64_MAX if call has no deadline
+   */
+  uint64_t m_nDeadline;
+
+  /**
+   * Number of running (not waiting) threads of call: thread of call and started workers of mdz_ext_processRange()
+   */
+  size_t m_nThreads;
+  struct mdz_ext_schedTask* m_pNext;
+};
+
+/**
+ * Add call of pAsyncData into list of running calls, using parameters set with mdz_ansi_asyncSetPriority() (or MDZ_ANSI_PRIORITY_NORMAL without deadline)
+ */
+void mdz_ext_schedEnter(struct mdz_ext_schedTask* pTask, const struct mdz_asyncData* pAsyncData);
+
+/**
+ * Remove call from list of running calls and wake calls waiting in mdz_ext_schedPoint()
+ */
+void mdz_ext_schedLeave(struct mdz_ext_schedTask* pTask);
+
+/**
+ * Count worker thread of running call of pAsyncData: bStarted is mdz_true before worker is started, mdz_false when it finishes (or cannot be started)
+ */
+void mdz_ext_schedWorker(const struct mdz_asyncData* pAsyncData, mdz_bool bStarted);
+
+/**
+ * Remove parameters set with mdz_ansi_asyncSetPriority() for call, which fails before it starts. Nothing is done if pAsyncData is NULL or has no parameters
+ */
+void mdz_ext_schedDiscard(const struct mdz_asyncData* pAsyncData);
+
+/**
+ * Scheduling point of asynchronous call on chunk border. Thread waits while at least mdz_ext_cpuCount() threads of calls of higher rank are running (or until call is cancelled).
+ * Does not take lock while number of running threads does not exceed number of processors
+ * \return:
+ * mdz_true  - if call is cancelled
+ * mdz_false - call should continue
+ */
+mdz_bool mdz_ext_schedPoint(const struct mdz_asyncData* pAsyncData);
+
+/**
+ * Check cancellation of call on chunk border (see mdz_ext_schedPoint()). Synchronous calls (pAsyncData == NULL) are never cancelled
+ */
+#define mdz_ext_isCancelled(pAsyncData) (NULL != (pAsyncData) && mdz_ext_schedPoint(pAsyncData))
+
+/**
+ * \defgroup Byte-set kernels
+ */
+
+/**
+ * Set of bytes, prepared for fast membership tests
+ */
+struct mdz_ext_byteSet
+{
+  /**
+   * 1 for bytes contained in set, otherwise 0
+   */
+  unsigned char m_aLookup[256];
+
+  /**
+   * Nibble bitmaps for SIMD tests: bit (h & 7) of m_aBitmap[h >> 3][l] is set if byte (h << 4 | l) is contained in set
+   */
+  unsigned char m_aBitmap[2][16];
+
+  /**
+   * First different bytes of set (up to 4), for sets compared item by item
+   */
+  unsigned char m_aItems[4];
+
+  /**
+   * Number of different bytes in set
+   */
+  size_t m_nCount;
+};
+
+/**
+ * Initialize pSet with nCount bytes of pcItems
+ */
+void mdz_ext_byteSetInit(struct mdz_ext_byteSet* pSet, const unsigned char* pcItems, size_t nCount);
+
+/**
+ * Add cItem to pSet
+ */
+void mdz_ext_byteSetAdd(struct mdz_ext_byteSet* pSet, unsigned char cItem);
+
+/**
+ * Return 0-based position of first byte in pcData which is (bMember == mdz_true) or is not (bMember == mdz_false) contained in pSet, or nSize if there is no such byte
+ */
+size_t mdz_ext_byteSetFirst(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember);
+
+/**
+ * Return 0-based position of last byte in pcData which is (bMember == mdz_true) or is not (bMember == mdz_false) contained in pSet, or nSize if there is no such byte
+ */
+size_t mdz_ext_byteSetLast(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nSize, mdz_bool bMember);
+
+/**
+ * Move items of [nFrom, nTo) of pcSrc which are not contained in pSet to position nWrite of pcDest. pcDest may be pcSrc (with nWrite <= nFrom), otherwise buffers must not overlap.
+ * Bytes of pcDest till nWrite + (nTo - nFrom) may be overwritten. Return write position after moved items
+ */
+size_t mdz_ext_byteSetCompact(const struct mdz_ext_byteSet* pSet, unsigned char* pcDest, size_t nWrite, const unsigned char* pcSrc, size_t nFrom, size_t nTo);
+
+/**
+ * \defgroup Find kernels
+ */
+
+/**
+ * Return kernel, which mdz_ext_findData() (or mdz_ext_rfindData() if bReverse == mdz_true) uses for nSize bytes of data and nCount items. nCount must be > 0 and <= nSize
+ */
+enum mdz_ansi_stats_kernel mdz_ext_findKernel(size_t nSize, size_t nCount, mdz_bool bReverse);
+
+/**
+ * Forward search kernel. Returns 0-based position of first occurrence of nCount items of pcItems in pcData, or nSize if not found. nCount must be > 0 and <= nSize
+ */
+typedef size_t (*mdz_ext_findFunc)(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount);
+
+/**
+ * Return forward search kernel for nSize bytes of data and nCount items (see mdz_ext_findKernel()). Searches repeated over one range should select kernel once. nCount must be > 0 and <= nSize
+ */
+mdz_ext_findFunc mdz_ext_findSelect(size_t nSize, size_t nCount);
+
+/**
+ * Return 0-based position of first occurrence of nCount items of pcItems in pcData, or nSize if not found. nCount must be > 0
+ */
+size_t mdz_ext_findData(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount);
+
+/**
+ * Return 0-based position of last occurrence of nCount items of pcItems in pcData, or nSize if not found. nCount must be > 0
+ */
+size_t mdz_ext_rfindData(const unsigned char* pcData, size_t nSize, const unsigned char* pcItems, size_t nCount);
+
+/**
+ * Return 0-based position of first (or last if bReverse == mdz_true) occurrence of nCount items of pcItems, residing in [nFrom, nTo) of pcData, or nTo if not found.
+ * If pAsyncData is not NULL, range is searched in windows of MDZ_ANSI_EXT_CANCEL_CHUNK bytes, m_bCancel is checked before every window and *pbCancelled is set if cancelled.
+ * Cancelled search returns position to resume from: no occurrence starts in [nFrom, returned) (or ends in [returned, nTo) if bReverse == mdz_true)
+ */
+size_t mdz_ext_findRange(const unsigned char* pcData, size_t nFrom, size_t nTo, const unsigned char* pcItems, size_t nCount, mdz_bool bReverse, const struct mdz_asyncData* pAsyncData, mdz_bool* pbCancelled);
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Layout functions of mdz_ansi_ext: fields of string are read from mdz_ansi library once, hot loops read them from mdz_ansi_layout without calls.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_getLayout(const struct mdz_Ansi* pAnsi, struct mdz_ansi_layout* pLayout)
+{
+  if (NULL == pAnsi || NULL == pLayout)
+  {
+    return mdz_false;
+  }
+
+  pLayout->m_pData = pAnsi->m_pData;
+  pLayout->m_nSize = mdz_ansi_size(pAnsi);
+  pLayout->m_nCapacity = mdz_ansi_capacity(pAnsi);
+  pLayout->m_nOffsetFromStart = mdz_ansi_offsetFromStart(pAnsi);
+  pLayout->m_bAttachedData = mdz_ansi_isAttachedData(pAnsi);
+
+  return mdz_true;
+}
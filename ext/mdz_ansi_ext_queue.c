@@ -0,0 +1,500 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Completion queues of mdz_ansi_ext. pAsyncData added to queue is kept in global registry (hash of pointers), thread of asynchronous call
+ * moves it into completed list of its queue after the call is finished. Notification handle is readable while completed list is not empty.
+ *
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+/**
+ * Number of buckets in registry of added pAsyncData
+ */
+#define MDZ_EXT_QUEUE_BUCKETS 256
+
+#ifdef _WIN32
+#define MDZ_EXT_LOCK SRWLOCK
+#define MDZ_EXT_LOCK_INIT SRWLOCK_INIT
+#define mdz_ext_lock(pLock) AcquireSRWLockExclusive(pLock)
+#define mdz_ext_unlock(pLock) ReleaseSRWLockExclusive(pLock)
+#else
+#define MDZ_EXT_LOCK pthread_mutex_t
+#define MDZ_EXT_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define mdz_ext_lock(pLock) pthread_mutex_lock(pLock)
+#define mdz_ext_unlock(pLock) pthread_mutex_unlock(pLock)
+#endif
+
+struct mdz_ext_queueEntry
+{
+  struct mdz_asyncData* m_pAsyncData;
+  struct mdz_ansi_queue* m_pQueue;
+  mdz_bool m_bStarted;
+  struct mdz_ext_queueEntry* m_pNext;
+};
+
+struct mdz_ansi_queue
+{
+  MDZ_EXT_LOCK m_oLock;
+#ifdef _WIN32
+  CONDITION_VARIABLE m_oCompleted;
+  HANDLE m_hEvent;
+#else
+  pthread_cond_t m_oCompleted;
+  int m_nReadFd;
+  int m_nWriteFd;
+#endif
+  struct mdz_ext_queueEntry* m_pFirst;
+  struct mdz_ext_queueEntry* m_pLast;
+
+  /**
+   * Number of entries of queue in registry (calls not finished yet). Protected by m_oRegistryLock
+   */
+  size_t m_nAdded;
+};
+
+/**
+ * Registry is protected by m_oRegistryLock. Lock of queue is taken only under m_oRegistryLock or alone
+ */
+static MDZ_EXT_LOCK m_oRegistryLock = MDZ_EXT_LOCK_INIT;
+
+static struct mdz_ext_queueEntry* m_aRegistry[MDZ_EXT_QUEUE_BUCKETS];
+
+static volatile size_t m_nRegistered = 0;
+
+static size_t mdz_ext_queueBucket(const struct mdz_asyncData* pAsyncData)
+{
+  size_t nHash = (size_t) pAsyncData;
+
+  nHash ^= nHash >> 12;
+  return (nHash ^ (nHash >> 4)) % MDZ_EXT_QUEUE_BUCKETS;
+}
+
+/**
+ * \defgroup Notification handle. Is signalled while completed list is not empty
+ */
+
+static mdz_bool mdz_ext_queueOpenHandle(struct mdz_ansi_queue* pQueue)
+{
+#ifdef _WIN32
+  pQueue->m_hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+  return (NULL != pQueue->m_hEvent);
+#elif defined(__linux__)
+  pQueue->m_nReadFd = eventfd(0, EFD_CLOEXEC);
+  pQueue->m_nWriteFd = pQueue->m_nReadFd;
+  return (pQueue->m_nReadFd >= 0);
+#else
+  int aFds[2];
+
+  if (0 != pipe(aFds))
+  {
+    return mdz_false;
+  }
+
+  pQueue->m_nReadFd = aFds[0];
+  pQueue->m_nWriteFd = aFds[1];
+  return mdz_true;
+#endif
+}
+
+static void mdz_ext_queueCloseHandle(struct mdz_ansi_queue* pQueue)
+{
+#ifdef _WIN32
+  CloseHandle(pQueue->m_hEvent);
+#else
+  close(pQueue->m_nReadFd);
+  if (pQueue->m_nWriteFd != pQueue->m_nReadFd)
+  {
+    close(pQueue->m_nWriteFd);
+  }
+#endif
+}
+
+static void mdz_ext_queueSignal(struct mdz_ansi_queue* pQueue, mdz_bool bSignal)
+{
+#ifdef _WIN32
+  if (bSignal)
+  {
+    SetEvent(pQueue->m_hEvent);
+  }
+  else
+  {
+    ResetEvent(pQueue->m_hEvent);
+  }
+#else
+  /* eventfd counter (or pipe) holds exactly 1 while signalled, thus read never blocks */
+#ifdef __linux__
+  uint64_t nValue = 1;
+#else
+  unsigned char nValue = 1;
+#endif
+  ssize_t nRet;
+
+  do
+  {
+    nRet = bSignal ? write(pQueue->m_nWriteFd, &nValue, sizeof(nValue)) : read(pQueue->m_nReadFd, &nValue, sizeof(nValue));
+  }
+  while (nRet < 0 && EINTR == errno);
+#endif
+}
+
+/**
+ * \defgroup Waiting
+ */
+
+#ifndef _WIN32
+static void mdz_ext_queueDeadline(struct timespec* pDeadline, size_t nTimeoutMs)
+{
+  clock_gettime(CLOCK_REALTIME, pDeadline);
+
+  pDeadline->tv_sec += (time_t) (nTimeoutMs / 1000);
+  pDeadline->tv_nsec += (long) (nTimeoutMs % 1000) * 1000000L;
+  if (pDeadline->tv_nsec >= 1000000000L)
+  {
+    pDeadline->tv_sec += 1;
+    pDeadline->tv_nsec -= 1000000000L;
+  }
+}
+#endif
+
+/**
+ * Wait on condition of pQueue until completed list is not empty or timeout expires. Lock of pQueue must be taken
+ */
+static void mdz_ext_queueWait(struct mdz_ansi_queue* pQueue, size_t nTimeoutMs)
+{
+#ifdef _WIN32
+  DWORD nStart = GetTickCount();
+  DWORD nElapsed;
+
+  while (NULL == pQueue->m_pFirst)
+  {
+    if (SIZE_MAX == nTimeoutMs)
+    {
+      SleepConditionVariableSRW(&pQueue->m_oCompleted, &pQueue->m_oLock, INFINITE, 0);
+      continue;
+    }
+
+    nElapsed = GetTickCount() - nStart;
+    if (nElapsed >= nTimeoutMs || !SleepConditionVariableSRW(&pQueue->m_oCompleted, &pQueue->m_oLock, (DWORD) (nTimeoutMs - nElapsed), 0))
+    {
+      break;
+    }
+  }
+#else
+  struct timespec oDeadline;
+
+  if (SIZE_MAX != nTimeoutMs)
+  {
+    mdz_ext_queueDeadline(&oDeadline, nTimeoutMs);
+  }
+
+  while (NULL == pQueue->m_pFirst)
+  {
+    if (SIZE_MAX == nTimeoutMs)
+    {
+      pthread_cond_wait(&pQueue->m_oCompleted, &pQueue->m_oLock);
+    }
+    else if (ETIMEDOUT == pthread_cond_timedwait(&pQueue->m_oCompleted, &pQueue->m_oLock, &oDeadline))
+    {
+      break;
+    }
+  }
+#endif
+}
+
+/**
+ * Wait for end of thread of harvested call
+ */
+static void mdz_ext_queueJoin(struct mdz_asyncData* pAsyncData)
+{
+#ifdef _WIN32
+  WaitForSingleObject(pAsyncData->m_hThread, INFINITE);
+  CloseHandle(pAsyncData->m_hThread);
+#else
+  pthread_join(pAsyncData->m_hThread, NULL);
+#endif
+}
+
+/**
+ * \defgroup Posting of completions
+ */
+
+void mdz_ext_queuePost(struct mdz_asyncData* pAsyncData, mdz_bool bStarted)
+{
+  struct mdz_ext_queueEntry** ppEntry;
+  struct mdz_ext_queueEntry* pEntry;
+  struct mdz_ansi_queue* pQueue;
+
+  /* calls without queues do not take the lock. Read without lock cannot miss entry of pAsyncData: it is added before thread of call is created */
+  if (0 == m_nRegistered)
+  {
+    return;
+  }
+
+  mdz_ext_lock(&m_oRegistryLock);
+
+  for (ppEntry = &m_aRegistry[mdz_ext_queueBucket(pAsyncData)]; NULL != *ppEntry; ppEntry = &(*ppEntry)->m_pNext)
+  {
+    if ((*ppEntry)->m_pAsyncData == pAsyncData)
+    {
+      break;
+    }
+  }
+
+  pEntry = *ppEntry;
+  if (NULL != pEntry)
+  {
+    *ppEntry = pEntry->m_pNext;
+    --m_nRegistered;
+
+    pQueue = pEntry->m_pQueue;
+    --pQueue->m_nAdded;
+    pEntry->m_bStarted = bStarted;
+    pEntry->m_pNext = NULL;
+
+    /* queue cannot be destroyed while registry lock is taken, because destroy removes its entries under this lock */
+    mdz_ext_lock(&pQueue->m_oLock);
+
+    if (NULL == pQueue->m_pFirst)
+    {
+      pQueue->m_pFirst = pEntry;
+      mdz_ext_queueSignal(pQueue, mdz_true);
+    }
+    else
+    {
+      pQueue->m_pLast->m_pNext = pEntry;
+    }
+    pQueue->m_pLast = pEntry;
+
+#ifdef _WIN32
+    WakeAllConditionVariable(&pQueue->m_oCompleted);
+#else
+    pthread_cond_broadcast(&pQueue->m_oCompleted);
+#endif
+
+    mdz_ext_unlock(&pQueue->m_oLock);
+  }
+
+  mdz_ext_unlock(&m_oRegistryLock);
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+struct mdz_ansi_queue* mdz_ansi_queueCreate(void)
+{
+  struct mdz_ansi_queue* pQueue = (struct mdz_ansi_queue*) malloc(sizeof(struct mdz_ansi_queue));
+
+  if (NULL == pQueue)
+  {
+    return NULL;
+  }
+
+  if (!mdz_ext_queueOpenHandle(pQueue))
+  {
+    free(pQueue);
+    return NULL;
+  }
+
+#ifdef _WIN32
+  InitializeSRWLock(&pQueue->m_oLock);
+  InitializeConditionVariable(&pQueue->m_oCompleted);
+#else
+  pthread_mutex_init(&pQueue->m_oLock, NULL);
+  pthread_cond_init(&pQueue->m_oCompleted, NULL);
+#endif
+
+  pQueue->m_pFirst = NULL;
+  pQueue->m_pLast = NULL;
+  pQueue->m_nAdded = 0;
+
+  return pQueue;
+}
+
+void mdz_ansi_queueDestroy(struct mdz_ansi_queue** ppQueue)
+{
+  struct mdz_ansi_queue* pQueue;
+  struct mdz_ext_queueEntry** ppEntry;
+  struct mdz_ext_queueEntry* pEntry;
+  size_t i;
+
+  if (NULL == ppQueue || NULL == *ppQueue)
+  {
+    return;
+  }
+
+  pQueue = *ppQueue;
+
+  mdz_ext_lock(&m_oRegistryLock);
+
+  for (i = 0; i < MDZ_EXT_QUEUE_BUCKETS && pQueue->m_nAdded > 0; ++i)
+  {
+    ppEntry = &m_aRegistry[i];
+    while (NULL != *ppEntry)
+    {
+      pEntry = *ppEntry;
+      if (pEntry->m_pQueue == pQueue)
+      {
+        *ppEntry = pEntry->m_pNext;
+        --m_nRegistered;
+        --pQueue->m_nAdded;
+        free(pEntry);
+      }
+      else
+      {
+        ppEntry = &pEntry->m_pNext;
+      }
+    }
+  }
+
+  mdz_ext_unlock(&m_oRegistryLock);
+
+  while (NULL != pQueue->m_pFirst)
+  {
+    pEntry = pQueue->m_pFirst;
+    pQueue->m_pFirst = pEntry->m_pNext;
+
+    if (pEntry->m_bStarted)
+    {
+      mdz_ext_queueJoin(pEntry->m_pAsyncData);
+    }
+    free(pEntry);
+  }
+
+  mdz_ext_queueCloseHandle(pQueue);
+#ifndef _WIN32
+  pthread_cond_destroy(&pQueue->m_oCompleted);
+  pthread_mutex_destroy(&pQueue->m_oLock);
+#endif
+
+  free(pQueue);
+  *ppQueue = NULL;
+}
+
+mdz_bool mdz_ansi_queueAdd(struct mdz_ansi_queue* pQueue, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_queueEntry* pEntry;
+  size_t nBucket;
+
+  if (NULL == pQueue || NULL == pAsyncData)
+  {
+    return mdz_false;
+  }
+
+  pEntry = (struct mdz_ext_queueEntry*) malloc(sizeof(struct mdz_ext_queueEntry));
+  if (NULL == pEntry)
+  {
+    return mdz_false;
+  }
+
+  pEntry->m_pAsyncData = pAsyncData;
+  pEntry->m_pQueue = pQueue;
+  pEntry->m_bStarted = mdz_false;
+
+  nBucket = mdz_ext_queueBucket(pAsyncData);
+
+  mdz_ext_lock(&m_oRegistryLock);
+
+  pEntry->m_pNext = m_aRegistry[nBucket];
+  m_aRegistry[nBucket] = pEntry;
+  ++m_nRegistered;
+  ++pQueue->m_nAdded;
+
+  mdz_ext_unlock(&m_oRegistryLock);
+
+  return mdz_true;
+}
+
+size_t mdz_ansi_queueHarvest(struct mdz_ansi_queue* pQueue, struct mdz_asyncData** ppCompleted, size_t nMaxCount, size_t nTimeoutMs)
+{
+  struct mdz_ext_queueEntry* pFirst;
+  struct mdz_ext_queueEntry* pLast = NULL;
+  struct mdz_ext_queueEntry* pEntry;
+  size_t nCount = 0;
+
+  if (NULL == pQueue || NULL == ppCompleted || 0 == nMaxCount)
+  {
+    return 0;
+  }
+
+  mdz_ext_lock(&pQueue->m_oLock);
+
+  if (NULL == pQueue->m_pFirst && 0 != nTimeoutMs)
+  {
+    mdz_ext_queueWait(pQueue, nTimeoutMs);
+  }
+
+  /* up to nMaxCount entries are detached from completed list */
+  pFirst = pQueue->m_pFirst;
+  for (pEntry = pFirst; NULL != pEntry && nCount < nMaxCount; pEntry = pEntry->m_pNext)
+  {
+    pLast = pEntry;
+    ++nCount;
+  }
+
+  if (NULL != pLast)
+  {
+    pLast->m_pNext = NULL;
+    pQueue->m_pFirst = pEntry;
+
+    if (NULL == pEntry)
+    {
+      pQueue->m_pLast = NULL;
+      mdz_ext_queueSignal(pQueue, mdz_false);
+    }
+  }
+
+  mdz_ext_unlock(&pQueue->m_oLock);
+
+  /* threads are joined outside of lock: thread of call posts completion as its last action, thus join returns at once */
+  for (nCount = 0; NULL != pFirst; ++nCount)
+  {
+    pEntry = pFirst;
+    pFirst = pEntry->m_pNext;
+
+    if (pEntry->m_bStarted)
+    {
+      mdz_ext_queueJoin(pEntry->m_pAsyncData);
+    }
+
+    ppCompleted[nCount] = pEntry->m_pAsyncData;
+    free(pEntry);
+  }
+
+  return nCount;
+}
+
+#ifdef _WIN32
+HANDLE mdz_ansi_queueHandle(const struct mdz_ansi_queue* pQueue)
+{
+  return (NULL != pQueue) ? pQueue->m_hEvent : NULL;
+}
+#else
+int mdz_ansi_queueHandle(const struct mdz_ansi_queue* pQueue)
+{
+  return (NULL != pQueue) ? pQueue->m_nReadFd : -1;
+}
+#endif
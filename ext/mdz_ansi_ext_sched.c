@@ -0,0 +1,397 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Scheduling of asynchronous calls of mdz_ansi_ext. Running calls are kept in list ordered by rank (priority class, then deadline).
+ * Threads of calls are time-sliced on chunk borders (the same places where m_bCancel is checked): thread waits there while at least "number of processors" threads
+ * of calls of higher rank are running. Running threads are counted per call: thread of call and worker threads of mdz_ext_processRange(), waiting threads are not counted.
+ * Calls of equal rank never wait for each other, thus calls without scheduling parameters share processors as before.
+ *
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+/**
+ * Number of buckets in registry of scheduling parameters set before calls
+ */
+#define MDZ_EXT_SCHED_BUCKETS 64
+
+/**
+ * Interval in milliseconds, after which waiting call re-checks m_bCancel
+ */
+#define MDZ_EXT_SCHED_POLL_MS 1
+
+#ifdef _WIN32
+#define MDZ_EXT_LOCK SRWLOCK
+#define MDZ_EXT_LOCK_INIT SRWLOCK_INIT
+#define mdz_ext_lock(pLock) AcquireSRWLockExclusive(pLock)
+#define mdz_ext_unlock(pLock) ReleaseSRWLockExclusive(pLock)
+#else
+#define MDZ_EXT_LOCK pthread_mutex_t
+#define MDZ_EXT_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define mdz_ext_lock(pLock) pthread_mutex_lock(pLock)
+#define mdz_ext_unlock(pLock) pthread_mutex_unlock(pLock)
+#endif
+
+struct mdz_ext_schedParams
+{
+  const struct mdz_asyncData* m_pAsyncData;
+  enum mdz_ansi_priority m_enPriority;
+  size_t m_nDeadlineMs;
+  struct mdz_ext_schedParams* m_pNext;
+};
+
+/**
+ * Registry, list of running calls and counters are protected by m_oSchedLock
+ */
+static MDZ_EXT_LOCK m_oSchedLock = MDZ_EXT_LOCK_INIT;
+
+#ifdef _WIN32
+static CONDITION_VARIABLE m_oSchedChanged = CONDITION_VARIABLE_INIT;
+#else
+static pthread_cond_t m_oSchedChanged = PTHREAD_COND_INITIALIZER;
+#endif
+
+static struct mdz_ext_schedParams* m_aSchedRegistry[MDZ_EXT_SCHED_BUCKETS];
+
+/**
+ * Number of registered parameters. Is read without lock by mdz_ext_schedDiscard(): if it is 0, nothing has to be removed
+ */
+static volatile size_t m_nSchedRegistered = 0;
+
+static struct mdz_ext_schedTask* m_pSchedFirst = NULL;
+
+/**
+ * Number of running threads of all calls. Is read without lock on chunk borders: while it does not exceed number of processors, no thread has to wait
+ */
+static volatile size_t m_nSchedThreads = 0;
+
+static size_t mdz_ext_schedBucket(const struct mdz_asyncData* pAsyncData)
+{
+  size_t nHash = (size_t) pAsyncData;
+
+  nHash ^= nHash >> 12;
+  return (nHash ^ (nHash >> 4)) % MDZ_EXT_SCHED_BUCKETS;
+}
+
+/**
+ * Monotonic time in milliseconds
+ */
+static uint64_t mdz_ext_schedNow(void)
+{
+#ifdef _WIN32
+  return (uint64_t) GetTickCount64();
+#else
+  struct timespec oTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &oTime);
+  return (uint64_t) oTime.tv_sec * 1000u + (uint64_t) oTime.tv_nsec / 1000000u;
+#endif
+}
+
+/**
+ * Return mdz_true if pFirst has higher rank than pSecond
+ */
+static mdz_bool mdz_ext_schedBefore(const struct mdz_ext_schedTask* pFirst, const struct mdz_ext_schedTask* pSecond)
+{
+  if (pFirst->m_enPriority != pSecond->m_enPriority)
+  {
+    return (pFirst->m_enPriority > pSecond->m_enPriority);
+  }
+
+  return (pFirst->m_nDeadline < pSecond->m_nDeadline);
+}
+
+/**
+ * Wait until list of running calls is changed, or MDZ_EXT_SCHED_POLL_MS elapsed. m_oSchedLock must be taken
+ */
+static void mdz_ext_schedWait(void)
+{
+#ifdef _WIN32
+  SleepConditionVariableSRW(&m_oSchedChanged, &m_oSchedLock, MDZ_EXT_SCHED_POLL_MS, 0);
+#else
+  struct timespec oDeadline;
+
+  clock_gettime(CLOCK_REALTIME, &oDeadline);
+  oDeadline.tv_nsec += MDZ_EXT_SCHED_POLL_MS * 1000000L;
+  if (oDeadline.tv_nsec >= 1000000000L)
+  {
+    oDeadline.tv_sec += 1;
+    oDeadline.tv_nsec -= 1000000000L;
+  }
+
+  pthread_cond_timedwait(&m_oSchedChanged, &m_oSchedLock, &oDeadline);
+#endif
+}
+
+/**
+ * Return running call of pAsyncData, or NULL. m_oSchedLock must be taken
+ */
+static struct mdz_ext_schedTask* mdz_ext_schedFind(const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_schedTask* pTask;
+
+  for (pTask = m_pSchedFirst; NULL != pTask && pTask->m_pAsyncData != pAsyncData; pTask = pTask->m_pNext)
+  {
+  }
+
+  return pTask;
+}
+
+/**
+ * Remove parameters of pAsyncData from registry and return them, or NULL if not registered. m_oSchedLock must be taken
+ */
+static struct mdz_ext_schedParams* mdz_ext_schedTake(const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_schedParams** ppParams;
+  struct mdz_ext_schedParams* pParams;
+
+  for (ppParams = &m_aSchedRegistry[mdz_ext_schedBucket(pAsyncData)]; NULL != *ppParams; ppParams = &(*ppParams)->m_pNext)
+  {
+    if ((*ppParams)->m_pAsyncData == pAsyncData)
+    {
+      pParams = *ppParams;
+      *ppParams = pParams->m_pNext;
+      --m_nSchedRegistered;
+      return pParams;
+    }
+  }
+
+  return NULL;
+}
+
+static void mdz_ext_schedNotify(void)
+{
+#ifdef _WIN32
+  WakeAllConditionVariable(&m_oSchedChanged);
+#else
+  pthread_cond_broadcast(&m_oSchedChanged);
+#endif
+}
+
+/**
+ * \defgroup Running calls
+ */
+
+void mdz_ext_schedEnter(struct mdz_ext_schedTask* pTask, const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_schedParams* pParams = NULL;
+  struct mdz_ext_schedTask** ppTask;
+  uint64_t nNow = mdz_ext_schedNow();
+
+  pTask->m_pAsyncData = pAsyncData;
+  pTask->m_enPriority = MDZ_ANSI_PRIORITY_NORMAL;
+  pTask->m_nDeadline = UINT64_MAX;
+  pTask->m_nThreads = 1;
+
+  mdz_ext_lock(&m_oSchedLock);
+
+  /* parameters are used by one call only */
+  if (m_nSchedRegistered > 0)
+  {
+    pParams = mdz_ext_schedTake(pAsyncData);
+  }
+
+  if (NULL != pParams)
+  {
+    pTask->m_enPriority = pParams->m_enPriority;
+    /* huge deadlines saturate, otherwise they would wrap and sort as the most urgent */
+    if (SIZE_MAX != pParams->m_nDeadlineMs)
+    {
+      pTask->m_nDeadline = ((uint64_t) pParams->m_nDeadlineMs > UINT64_MAX - nNow) ? UINT64_MAX : nNow + pParams->m_nDeadlineMs;
+    }
+  }
+
+  /* call is inserted after calls of equal rank */
+  for (ppTask = &m_pSchedFirst; NULL != *ppTask && !mdz_ext_schedBefore(pTask, *ppTask); ppTask = &(*ppTask)->m_pNext)
+  {
+  }
+
+  pTask->m_pNext = *ppTask;
+  *ppTask = pTask;
+  ++m_nSchedThreads;
+
+  mdz_ext_unlock(&m_oSchedLock);
+
+  free(pParams);
+}
+
+void mdz_ext_schedLeave(struct mdz_ext_schedTask* pTask)
+{
+  struct mdz_ext_schedTask** ppTask;
+
+  mdz_ext_lock(&m_oSchedLock);
+
+  for (ppTask = &m_pSchedFirst; NULL != *ppTask; ppTask = &(*ppTask)->m_pNext)
+  {
+    if (*ppTask == pTask)
+    {
+      *ppTask = pTask->m_pNext;
+      m_nSchedThreads -= pTask->m_nThreads;
+      break;
+    }
+  }
+
+  mdz_ext_schedNotify();
+
+  mdz_ext_unlock(&m_oSchedLock);
+}
+
+void mdz_ext_schedWorker(const struct mdz_asyncData* pAsyncData, mdz_bool bStarted)
+{
+  struct mdz_ext_schedTask* pTask;
+
+  mdz_ext_lock(&m_oSchedLock);
+
+  pTask = mdz_ext_schedFind(pAsyncData);
+  if (NULL != pTask)
+  {
+    if (bStarted)
+    {
+      ++pTask->m_nThreads;
+      ++m_nSchedThreads;
+    }
+    else
+    {
+      --pTask->m_nThreads;
+      --m_nSchedThreads;
+      mdz_ext_schedNotify();
+    }
+  }
+
+  mdz_ext_unlock(&m_oSchedLock);
+}
+
+void mdz_ext_schedDiscard(const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_schedParams* pParams;
+
+  if (NULL == pAsyncData || 0 == m_nSchedRegistered)
+  {
+    return;
+  }
+
+  mdz_ext_lock(&m_oSchedLock);
+  pParams = mdz_ext_schedTake(pAsyncData);
+  mdz_ext_unlock(&m_oSchedLock);
+
+  free(pParams);
+}
+
+mdz_bool mdz_ext_schedPoint(const struct mdz_asyncData* pAsyncData)
+{
+  const struct mdz_ext_schedTask* pTask;
+  struct mdz_ext_schedTask* pSelf;
+  mdz_bool bWaiting = mdz_false;
+  size_t nSlots;
+  size_t nAbove;
+
+  if (m_nSchedThreads > (nSlots = mdz_ext_cpuCount()))
+  {
+    mdz_ext_lock(&m_oSchedLock);
+
+    pSelf = mdz_ext_schedFind(pAsyncData);
+
+    /* thread waits while all processors are taken by running threads of calls of higher rank. Threads of the highest call never wait, thus some call always progresses */
+    while (NULL != pSelf && !*(volatile const mdz_bool*) &pAsyncData->m_bCancel)
+    {
+      /* calls of higher rank are at the beginning of list */
+      nAbove = 0;
+      for (pTask = m_pSchedFirst; pTask != pSelf && mdz_ext_schedBefore(pTask, pSelf); pTask = pTask->m_pNext)
+      {
+        nAbove += pTask->m_nThreads;
+      }
+
+      if (nAbove < nSlots)
+      {
+        break;
+      }
+
+      /* waiting thread does not take processor, thus it is not counted while it waits */
+      if (!bWaiting)
+      {
+        bWaiting = mdz_true;
+        --pSelf->m_nThreads;
+        --m_nSchedThreads;
+        mdz_ext_schedNotify();
+      }
+
+      mdz_ext_schedWait();
+    }
+
+    if (bWaiting)
+    {
+      ++pSelf->m_nThreads;
+      ++m_nSchedThreads;
+    }
+
+    mdz_ext_unlock(&m_oSchedLock);
+  }
+
+  return *(volatile const mdz_bool*) &pAsyncData->m_bCancel;
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_asyncSetPriority(const struct mdz_asyncData* pAsyncData, enum mdz_ansi_priority enPriority, size_t nDeadlineMs)
+{
+  struct mdz_ext_schedParams* pParams;
+  size_t nBucket;
+
+  if (NULL == pAsyncData || (unsigned int) enPriority > (unsigned int) MDZ_ANSI_PRIORITY_URGENT)
+  {
+    return mdz_false;
+  }
+
+  nBucket = mdz_ext_schedBucket(pAsyncData);
+
+  mdz_ext_lock(&m_oSchedLock);
+
+  for (pParams = m_aSchedRegistry[nBucket]; NULL != pParams; pParams = pParams->m_pNext)
+  {
+    if (pParams->m_pAsyncData == pAsyncData)
+    {
+      break;
+    }
+  }
+
+  if (NULL == pParams)
+  {
+    pParams = (struct mdz_ext_schedParams*) malloc(sizeof(struct mdz_ext_schedParams));
+    if (NULL == pParams)
+    {
+      mdz_ext_unlock(&m_oSchedLock);
+      return mdz_false;
+    }
+
+    pParams->m_pAsyncData = pAsyncData;
+    pParams->m_pNext = m_aSchedRegistry[nBucket];
+    m_aSchedRegistry[nBucket] = pParams;
+    ++m_nSchedRegistered;
+  }
+
+  pParams->m_enPriority = enPriority;
+  pParams->m_nDeadlineMs = nDeadlineMs;
+
+  mdz_ext_unlock(&m_oSchedLock);
+
+  return mdz_true;
+}
@@ -0,0 +1,142 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Search functions of mdz_ansi_ext: forward and reverse searches use the same SIMD kernels (see mdz_ansi_ext_find.c).
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+/**
+ * Return 0-based position of first (or last if bReverse == mdz_true) occurrence of pcItems between nLeftPos and nRightPos, or Size if not found or parameters are invalid.
+ * If call is cancelled, mdz_false is set into *pbFinished and new nLeftPos (or new nRightPos if bReverse == mdz_true) to resume search from is returned. pbFinished is not used if pAsyncData is NULL
+ */
+static size_t mdz_ext_searchAnsi(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, mdz_bool bReverse, const struct mdz_asyncData* pAsyncData, mdz_bool* pbFinished)
+{
+  size_t nSize = mdz_ansi_size(pAnsi);
+  size_t nFound;
+  mdz_bool bCancelled;
+
+  if (!mdz_ext_checkItems(pAnsi, pcItems, &nCount) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return nSize;
+  }
+
+  if (nCount > nRightPos - nLeftPos + 1)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_BIGCOUNT);
+    return nSize;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  nFound = mdz_ext_findRange((const unsigned char*) pAnsi->m_pData, nLeftPos, nRightPos + 1, (const unsigned char*) pcItems, nCount, bReverse, pAsyncData, &bCancelled);
+  if (bCancelled)
+  {
+    *pbFinished = mdz_false;
+    return bReverse ? nFound - 1 : nFound;
+  }
+
+  return (nFound <= nRightPos) ? nFound : nSize;
+}
+
+struct mdz_ext_searchArgs
+{
+  const struct mdz_Ansi* m_pAnsi;
+  size_t m_nLeftPos;
+  size_t m_nRightPos;
+  const char* m_pcItems;
+  size_t m_nCount;
+  char m_cItem;
+  mdz_bool m_bSingle;
+  mdz_bool m_bReverse;
+};
+
+static mdz_bool mdz_ext_searchAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_searchArgs* pArgs = (struct mdz_ext_searchArgs*) pParam;
+  const char* pcItems = pArgs->m_bSingle ? &pArgs->m_cItem : pArgs->m_pcItems;
+  mdz_bool bFinished = mdz_true;
+
+  pAsyncData->m_nResult = mdz_ext_searchAnsi(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pcItems, pArgs->m_nCount, pArgs->m_bReverse, pAsyncData, &bFinished);
+
+  return bFinished;
+}
+
+static size_t mdz_ext_search(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, char cItem, mdz_bool bSingle, mdz_bool bReverse, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  struct mdz_ext_searchArgs* pArgs;
+  size_t nRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return SIZE_MAX;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, bSingle ? MDZ_ANSI_STATS_RFINDSINGLEFAST : (bReverse ? MDZ_ANSI_STATS_RFINDFAST : MDZ_ANSI_STATS_FINDFAST), pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL == pAsyncData)
+  {
+    nRet = mdz_ext_searchAnsi(pAnsi, nLeftPos, nRightPos, bSingle ? &cItem : pcItems, nCount, bReverse, NULL, NULL);
+    mdz_ext_statsEnd(&oStatsCall, mdz_false);
+    return nRet;
+  }
+
+  /* single item is copied into arguments, because cItem does not live until end of asynchronous call */
+  pArgs = (struct mdz_ext_searchArgs*) malloc(sizeof(struct mdz_ext_searchArgs));
+  if (NULL != pArgs)
+  {
+    pArgs->m_pAnsi = pAnsi;
+    pArgs->m_nLeftPos = nLeftPos;
+    pArgs->m_nRightPos = nRightPos;
+    pArgs->m_pcItems = pcItems;
+    pArgs->m_nCount = nCount;
+    pArgs->m_cItem = cItem;
+    pArgs->m_bSingle = bSingle;
+    pArgs->m_bReverse = bReverse;
+  }
+
+  if (!mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_searchAsync, pArgs, &oStatsCall))
+  {
+    return SIZE_MAX;
+  }
+
+  return mdz_ansi_size(pAnsi);
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+size_t mdz_ansi_findFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  return mdz_ext_search(pAnsi, nLeftPos, nRightPos, pcItems, nCount, 0, mdz_false, mdz_false, pAsyncData);
+}
+
+size_t mdz_ansi_rfindFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  return mdz_ext_search(pAnsi, nLeftPos, nRightPos, pcItems, nCount, 0, mdz_false, mdz_true, pAsyncData);
+}
+
+size_t mdz_ansi_rfindSingleFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, char cItem, struct mdz_asyncData* pAsyncData)
+{
+  return mdz_ext_search(pAnsi, nLeftPos, nRightPos, NULL, 1, cItem, mdz_true, mdz_true, pAsyncData);
+}
+
+size_t mdz_ansi_findFastUnchecked(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount)
+{
+  return nLeftPos + mdz_ext_findData((const unsigned char*) pAnsi->m_pData + nLeftPos, nRightPos - nLeftPos + 1, (const unsigned char*) pcItems, nCount);
+}
+
+size_t mdz_ansi_rfindFastUnchecked(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount)
+{
+  return nLeftPos + mdz_ext_rfindData((const unsigned char*) pAnsi->m_pData + nLeftPos, nRightPos - nLeftPos + 1, (const unsigned char*) pcItems, nCount);
+}
@@ -0,0 +1,345 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Copy-on-write snapshots of mdz_ansi_ext. Shared string publishes immutable versions with reference counts. Readers pin current version without locks,
+ * writers publish modified copy and wait for grace period (readers, which might have read previous version pointer but not incremented its reference count yet) before
+ * dropping reference of shared string to previous version. Grace period is tracked by two reader counters, selected by parity of epoch (like SRCU): readers never wait.
+ *
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+#ifdef _WIN32
+#define MDZ_EXT_LOCK SRWLOCK
+#define mdz_ext_lockInit(pLock) (InitializeSRWLock(pLock), mdz_true)
+#define mdz_ext_lockDestroy(pLock)
+#define mdz_ext_lock(pLock) AcquireSRWLockExclusive(pLock)
+#define mdz_ext_unlock(pLock) ReleaseSRWLockExclusive(pLock)
+#define mdz_ext_yield() SwitchToThread()
+#else
+#define MDZ_EXT_LOCK pthread_mutex_t
+#define mdz_ext_lockInit(pLock) (0 == pthread_mutex_init(pLock, NULL))
+#define mdz_ext_lockDestroy(pLock) pthread_mutex_destroy(pLock)
+#define mdz_ext_lock(pLock) pthread_mutex_lock(pLock)
+#define mdz_ext_unlock(pLock) pthread_mutex_unlock(pLock)
+#define mdz_ext_yield() sched_yield()
+#endif
+
+#ifdef _WIN32
+#ifdef _WIN64
+#define mdz_ext_fetchAdd(pnTarget, nValue) ((size_t) InterlockedExchangeAdd64((volatile LONG64*) (pnTarget), (LONG64) (nValue)))
+#else
+#define mdz_ext_fetchAdd(pnTarget, nValue) ((size_t) InterlockedExchangeAdd((volatile LONG*) (pnTarget), (LONG) (nValue)))
+#endif
+#else
+#define mdz_ext_fetchAdd(pnTarget, nValue) __sync_fetch_and_add((pnTarget), (nValue))
+#endif
+
+/**
+ * Store of pointer with full barrier: version is initialized before it is visible for readers
+ */
+#ifdef _WIN32
+#define mdz_ext_publishPtr(ppTarget, pValue) ((void) InterlockedExchangePointer((PVOID volatile*) (ppTarget), (PVOID) (pValue)))
+#else
+#define mdz_ext_publishPtr(ppTarget, pValue) ((void) __sync_val_compare_and_swap((ppTarget), *(ppTarget), (pValue)))
+#endif
+
+/**
+ * Published version. String of version is not modified after publication (except m_enErrorCode, which is set by non-modifying functions of readers)
+ */
+struct mdz_ansi_snapshot
+{
+  struct mdz_Ansi* m_pAnsi;
+
+  /**
+   * Number of acquired snapshots, plus 1 while version is current version of shared string
+   */
+  volatile size_t m_nRefs;
+
+  size_t m_nVersion;
+};
+
+struct mdz_ansi_shared
+{
+  /**
+   * Current version. Is replaced only under m_oWriteLock
+   */
+  struct mdz_ansi_snapshot* volatile m_pCurrent;
+
+  /**
+   * Parity of epoch selects counter in m_aReaders, which is incremented by readers for duration of mdz_ansi_snapshotAcquire()
+   */
+  volatile size_t m_nEpoch;
+
+  volatile size_t m_aReaders[2];
+
+  /**
+   * Serializes writers. Is held from mdz_ansi_sharedBeginUpdate() till mdz_ansi_sharedEndUpdate()
+   */
+  MDZ_EXT_LOCK m_oWriteLock;
+
+  /**
+   * Version being updated between mdz_ansi_sharedBeginUpdate() and mdz_ansi_sharedEndUpdate(), or NULL
+   */
+  struct mdz_ansi_snapshot* m_pPending;
+};
+
+static struct mdz_ansi_snapshot* mdz_ext_snapshotCreate(struct mdz_Ansi* pAnsi)
+{
+  struct mdz_ansi_snapshot* pSnapshot = (struct mdz_ansi_snapshot*) malloc(sizeof(struct mdz_ansi_snapshot));
+
+  if (NULL != pSnapshot)
+  {
+    pSnapshot->m_pAnsi = pAnsi;
+    pSnapshot->m_nRefs = 1;
+    pSnapshot->m_nVersion = 0;
+  }
+
+  return pSnapshot;
+}
+
+static void mdz_ext_snapshotUnref(struct mdz_ansi_snapshot* pSnapshot)
+{
+  if (1 == mdz_ext_fetchAdd(&pSnapshot->m_nRefs, (size_t) -1))
+  {
+    mdz_ansi_destroy(&pSnapshot->m_pAnsi);
+    free(pSnapshot);
+  }
+}
+
+/**
+ * Replace current version of pShared with pSnapshot and drop reference of pShared to previous version after grace period. m_oWriteLock must be taken
+ */
+static void mdz_ext_sharedPublish(struct mdz_ansi_shared* pShared, struct mdz_ansi_snapshot* pSnapshot)
+{
+  struct mdz_ansi_snapshot* pPrevious = pShared->m_pCurrent;
+  size_t nIndex;
+  int i;
+
+  pSnapshot->m_nVersion = pPrevious->m_nVersion + 1;
+  mdz_ext_publishPtr(&pShared->m_pCurrent, pSnapshot);
+
+  /* epoch is flipped twice: reader, which has read epoch before first flip, may increment counter of either parity. Counter incremented after it is seen 0 belongs
+     to reader, which reads m_pCurrent after that, thus gets new version. fetchAdd is full barrier, thus m_pCurrent is stored before epoch is flipped */
+  for (i = 0; i < 2; ++i)
+  {
+    nIndex = mdz_ext_fetchAdd(&pShared->m_nEpoch, 1) & 1;
+
+    while (0 != mdz_ext_fetchAdd(&pShared->m_aReaders[nIndex], 0))
+    {
+      mdz_ext_yield();
+    }
+  }
+
+  mdz_ext_snapshotUnref(pPrevious);
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+struct mdz_ansi_shared* mdz_ansi_sharedCreate(struct mdz_Ansi* pAnsi)
+{
+  struct mdz_ansi_shared* pShared;
+
+  if (NULL == pAnsi)
+  {
+    return NULL;
+  }
+
+  pShared = (struct mdz_ansi_shared*) malloc(sizeof(struct mdz_ansi_shared));
+  if (NULL == pShared)
+  {
+    return NULL;
+  }
+
+  pShared->m_pCurrent = mdz_ext_snapshotCreate(pAnsi);
+  if (NULL == pShared->m_pCurrent)
+  {
+    free(pShared);
+    return NULL;
+  }
+
+  if (!mdz_ext_lockInit(&pShared->m_oWriteLock))
+  {
+    free(pShared->m_pCurrent);
+    free(pShared);
+    return NULL;
+  }
+
+  pShared->m_nEpoch = 0;
+  pShared->m_aReaders[0] = 0;
+  pShared->m_aReaders[1] = 0;
+  pShared->m_pPending = NULL;
+
+  return pShared;
+}
+
+mdz_bool mdz_ansi_sharedDestroy(struct mdz_ansi_shared** ppShared)
+{
+  struct mdz_ansi_shared* pShared;
+
+  if (NULL == ppShared || NULL == *ppShared)
+  {
+    return mdz_false;
+  }
+
+  pShared = *ppShared;
+
+  /* m_oWriteLock is owned by the writer and its copy is still used by it: shared string cannot be destroyed until mdz_ansi_sharedEndUpdate() */
+  if (NULL != pShared->m_pPending)
+  {
+    return mdz_false;
+  }
+
+  mdz_ext_snapshotUnref(pShared->m_pCurrent);
+  mdz_ext_lockDestroy(&pShared->m_oWriteLock);
+  free(pShared);
+
+  *ppShared = NULL;
+  return mdz_true;
+}
+
+struct mdz_ansi_snapshot* mdz_ansi_snapshotAcquire(struct mdz_ansi_shared* pShared)
+{
+  struct mdz_ansi_snapshot* pSnapshot;
+  size_t nIndex;
+
+  if (NULL == pShared)
+  {
+    return NULL;
+  }
+
+  nIndex = pShared->m_nEpoch & 1;
+
+  /* while counter is not 0, writer does not drop its reference to version, which is read here */
+  mdz_ext_fetchAdd(&pShared->m_aReaders[nIndex], 1);
+  pSnapshot = pShared->m_pCurrent;
+  mdz_ext_fetchAdd(&pSnapshot->m_nRefs, 1);
+  mdz_ext_fetchAdd(&pShared->m_aReaders[nIndex], (size_t) -1);
+
+  return pSnapshot;
+}
+
+const struct mdz_Ansi* mdz_ansi_snapshotAnsi(const struct mdz_ansi_snapshot* pSnapshot)
+{
+  return (NULL != pSnapshot) ? pSnapshot->m_pAnsi : NULL;
+}
+
+size_t mdz_ansi_snapshotVersion(const struct mdz_ansi_snapshot* pSnapshot)
+{
+  return (NULL != pSnapshot) ? pSnapshot->m_nVersion : SIZE_MAX;
+}
+
+void mdz_ansi_snapshotRelease(struct mdz_ansi_snapshot** ppSnapshot)
+{
+  if (NULL == ppSnapshot || NULL == *ppSnapshot)
+  {
+    return;
+  }
+
+  mdz_ext_snapshotUnref(*ppSnapshot);
+  *ppSnapshot = NULL;
+}
+
+struct mdz_Ansi* mdz_ansi_sharedBeginUpdate(struct mdz_ansi_shared* pShared)
+{
+  const struct mdz_Ansi* pCurrent;
+  struct mdz_Ansi* pCopy;
+  size_t nSize;
+
+  if (NULL == pShared)
+  {
+    return NULL;
+  }
+
+  mdz_ext_lock(&pShared->m_oWriteLock);
+
+  /* current version is not replaced while m_oWriteLock is taken, thus it is copied without taking reference. Readers may use it meanwhile: mdz_ansi_copyFast() only reads it
+     and reports result on pCopy, and range is valid, thus m_enErrorCode of current version is not written */
+  pCurrent = pShared->m_pCurrent->m_pAnsi;
+  nSize = mdz_ansi_size(pCurrent);
+
+  pCopy = mdz_ansi_create(0);
+  if (NULL != pCopy && nSize > 0 && (!mdz_ansi_copyFast(pCurrent, 0, nSize - 1, pCopy) || mdz_ansi_size(pCopy) != nSize))
+  {
+    mdz_ansi_destroy(&pCopy);
+  }
+
+  if (NULL != pCopy)
+  {
+    pShared->m_pPending = mdz_ext_snapshotCreate(pCopy);
+    if (NULL == pShared->m_pPending)
+    {
+      mdz_ansi_destroy(&pCopy);
+    }
+  }
+
+  if (NULL == pCopy)
+  {
+    mdz_ext_unlock(&pShared->m_oWriteLock);
+  }
+
+  return pCopy;
+}
+
+mdz_bool mdz_ansi_sharedEndUpdate(struct mdz_ansi_shared* pShared, mdz_bool bPublish)
+{
+  struct mdz_ansi_snapshot* pPending;
+
+  if (NULL == pShared || NULL == pShared->m_pPending)
+  {
+    return mdz_false;
+  }
+
+  pPending = pShared->m_pPending;
+  pShared->m_pPending = NULL;
+
+  if (bPublish)
+  {
+    mdz_ext_sharedPublish(pShared, pPending);
+  }
+  else
+  {
+    mdz_ext_snapshotUnref(pPending);
+  }
+
+  mdz_ext_unlock(&pShared->m_oWriteLock);
+
+  return mdz_true;
+}
+
+mdz_bool mdz_ansi_sharedPublish(struct mdz_ansi_shared* pShared, struct mdz_Ansi* pAnsi)
+{
+  struct mdz_ansi_snapshot* pSnapshot;
+
+  if (NULL == pShared || NULL == pAnsi)
+  {
+    return mdz_false;
+  }
+
+  pSnapshot = mdz_ext_snapshotCreate(pAnsi);
+  if (NULL == pSnapshot)
+  {
+    return mdz_false;
+  }
+
+  mdz_ext_lock(&pShared->m_oWriteLock);
+  mdz_ext_sharedPublish(pShared, pSnapshot);
+  mdz_ext_unlock(&pShared->m_oWriteLock);
+
+  return mdz_true;
+}
@@ -0,0 +1,524 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Call statistics of mdz_ansi_ext. Every thread updates its own block of counters without locks or atomic operations, blocks are kept in
+ * lock-free list and are summed by mdz_ansi_statsSnapshot(). Blocks of finished threads are re-used by new threads, thus counters are never lost.
+ * Where 64-bit counters are not written with one store (32-bit platforms), updates of block are enclosed in sequence counter and snapshot re-reads changed blocks.
+ *
+ */
+
+#if defined(MDZ_ANSI_EXT_STATS) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+#include "mdz_ansi_ext_internal.h"
+
+#ifdef MDZ_ANSI_EXT_STATS
+
+#if SIZE_MAX < UINT64_MAX
+#define MDZ_EXT_STATS_SEQUENCE
+#endif
+
+struct mdz_ext_statsBlock
+{
+  struct mdz_ansi_stats m_oStats;
+  struct mdz_ext_statsBlock* volatile m_pNext;
+  volatile long m_nInUse;
+
+  /**
+   * Odd while owner thread updates 64-bit counters. Is used only if MDZ_EXT_STATS_SEQUENCE is defined
+   */
+  volatile size_t m_nSequence;
+};
+
+static struct mdz_ext_statsBlock* volatile m_pStatsBlocks = NULL;
+
+static volatile int m_bStatsEnabled = 0;
+
+/**
+ * Durations are measured (clock is read twice per call) only if set
+ */
+static volatile int m_bStatsTiming = 0;
+
+/**
+ * Callback with its context. Registrations are immutable and never freed: a thread calling replaced callback still reads consistent pair
+ */
+struct mdz_ext_statsCallbackEntry
+{
+  mdz_ansi_statsCallback m_pfnCallback;
+  void* m_pContext;
+  struct mdz_ext_statsCallbackEntry* volatile m_pNext;
+};
+
+/**
+ * All registrations ever set, re-used if the same pair is set again
+ */
+static struct mdz_ext_statsCallbackEntry* volatile m_pStatsCallbacks = NULL;
+
+/**
+ * Current registration, or NULL. Is replaced atomically, thus callback is always called with context set together with it
+ */
+static struct mdz_ext_statsCallbackEntry* volatile m_pStatsCallback = NULL;
+
+#ifdef _WIN32
+#define mdz_ext_casLong(pTarget, nOld, nNew) (InterlockedCompareExchange((volatile LONG*) (pTarget), (nNew), (nOld)) == (nOld))
+#define mdz_ext_casPointer(ppTarget, pOld, pNew) (InterlockedCompareExchangePointer((PVOID volatile*) (ppTarget), (pNew), (pOld)) == (pOld))
+#define mdz_ext_statsFence() MemoryBarrier()
+
+static DWORD m_nStatsTls = TLS_OUT_OF_INDEXES;
+
+static volatile LONG m_nStatsTlsState = 0;
+
+static LARGE_INTEGER m_oStatsFrequency;
+#else
+#define mdz_ext_casLong(pTarget, nOld, nNew) __sync_bool_compare_and_swap((pTarget), (nOld), (nNew))
+#define mdz_ext_casPointer(ppTarget, pOld, pNew) __sync_bool_compare_and_swap((ppTarget), (pOld), (pNew))
+#define mdz_ext_statsFence() __sync_synchronize()
+
+static pthread_key_t m_oStatsKey;
+
+static pthread_once_t m_oStatsOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Called on exit of any thread which used statistics: block is released for re-use
+ */
+static void mdz_ext_statsDestructor(void* pBlock)
+{
+  ((struct mdz_ext_statsBlock*) pBlock)->m_nInUse = 0;
+}
+
+static void mdz_ext_statsCreateKey(void)
+{
+  pthread_key_create(&m_oStatsKey, mdz_ext_statsDestructor);
+}
+#endif
+
+static uint64_t mdz_ext_statsNow(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER oCounter;
+  QueryPerformanceCounter(&oCounter);
+  return (uint64_t) (oCounter.QuadPart / m_oStatsFrequency.QuadPart) * 1000000000u + (uint64_t) (oCounter.QuadPart % m_oStatsFrequency.QuadPart) * 1000000000u / (uint64_t) m_oStatsFrequency.QuadPart;
+#else
+  struct timespec oTime;
+  clock_gettime(CLOCK_MONOTONIC, &oTime);
+  return (uint64_t) oTime.tv_sec * 1000000000u + (uint64_t) oTime.tv_nsec;
+#endif
+}
+
+/**
+ * Initialize thread-local storage. Called from mdz_ansi_statsEnable() before any block is used
+ */
+static void mdz_ext_statsInit(void)
+{
+#ifdef _WIN32
+  if (mdz_ext_casLong(&m_nStatsTlsState, 0, 1))
+  {
+    QueryPerformanceFrequency(&m_oStatsFrequency);
+    m_nStatsTls = TlsAlloc();
+    m_nStatsTlsState = 2;
+  }
+
+  while (2 != m_nStatsTlsState)
+  {
+    Sleep(0);
+  }
+#else
+  pthread_once(&m_oStatsOnce, mdz_ext_statsCreateKey);
+#endif
+}
+
+/**
+ * Return block of counters of current thread. Free block of finished thread is claimed, or new block is allocated and pushed into list
+ */
+static struct mdz_ext_statsBlock* mdz_ext_statsBlock(void)
+{
+  struct mdz_ext_statsBlock* pBlock;
+
+#ifdef _WIN32
+  pBlock = (struct mdz_ext_statsBlock*) TlsGetValue(m_nStatsTls);
+#else
+  pBlock = (struct mdz_ext_statsBlock*) pthread_getspecific(m_oStatsKey);
+#endif
+
+  if (NULL != pBlock)
+  {
+    return pBlock;
+  }
+
+  for (pBlock = m_pStatsBlocks; NULL != pBlock; pBlock = pBlock->m_pNext)
+  {
+    if (0 == pBlock->m_nInUse && mdz_ext_casLong(&pBlock->m_nInUse, 0, 1))
+    {
+      break;
+    }
+  }
+
+  if (NULL == pBlock)
+  {
+    pBlock = (struct mdz_ext_statsBlock*) calloc(1, sizeof(struct mdz_ext_statsBlock));
+    if (NULL == pBlock)
+    {
+      return NULL;
+    }
+
+    pBlock->m_nInUse = 1;
+    do
+    {
+      pBlock->m_pNext = m_pStatsBlocks;
+    }
+    while (!mdz_ext_casPointer(&m_pStatsBlocks, pBlock->m_pNext, pBlock));
+  }
+
+#ifdef _WIN32
+  TlsSetValue(m_nStatsTls, pBlock);
+#else
+  pthread_setspecific(m_oStatsKey, pBlock);
+#endif
+
+  return pBlock;
+}
+
+void mdz_ext_statsBegin(struct mdz_ext_statsCall* pCall, enum mdz_ansi_stats_func enFunc, const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const struct mdz_Ansi* pDest)
+{
+  pCall->m_bActive = (mdz_bool) m_bStatsEnabled;
+  if (!pCall->m_bActive)
+  {
+    return;
+  }
+
+  pCall->m_pAnsi = pAnsi;
+  pCall->m_pDest = pDest;
+  pCall->m_enFunc = enFunc;
+  pCall->m_nBytes = 0;
+  pCall->m_nCapacity = (NULL != pDest) ? mdz_ansi_capacity(pDest) : 0;
+
+  /* range is taken from parameters: Size is read only for range till the end of string. Bytes of invalid range are dropped in mdz_ext_statsEnd() by error code */
+  if (NULL != pAnsi)
+  {
+    if (SIZE_MAX == nRightPos)
+    {
+      nRightPos = mdz_ansi_size(pAnsi) - 1;
+    }
+
+    if (nLeftPos <= nRightPos && SIZE_MAX != nRightPos)
+    {
+      pCall->m_nBytes = nRightPos - nLeftPos + 1;
+    }
+  }
+
+  pCall->m_bTimed = (mdz_bool) m_bStatsTiming;
+  if (pCall->m_bTimed)
+  {
+    pCall->m_nStart = mdz_ext_statsNow();
+  }
+}
+
+void mdz_ext_statsEnd(struct mdz_ext_statsCall* pCall, mdz_bool bAsync)
+{
+  struct mdz_ext_statsBlock* pBlock;
+  struct mdz_ansi_statsFunc* pFunc;
+  const struct mdz_ext_statsCallbackEntry* pCallback;
+  uint64_t nNanoseconds;
+  uint64_t nBucketValue;
+  size_t nBucket = 0;
+  size_t nCapacity;
+  enum mdz_error_code enError;
+
+  if (!pCall->m_bActive)
+  {
+    return;
+  }
+
+  /* call started with timing disabled is not measured, even if timing is enabled meanwhile */
+  nNanoseconds = pCall->m_bTimed ? mdz_ext_statsNow() - pCall->m_nStart : 0;
+
+  pBlock = mdz_ext_statsBlock();
+  if (NULL == pBlock)
+  {
+    return;
+  }
+
+  pFunc = &pBlock->m_oStats.m_aFuncs[pCall->m_enFunc];
+  enError = (NULL != pCall->m_pAnsi) ? pCall->m_pAnsi->m_enErrorCode : MDZ_ERROR_NONE;
+
+  ++pFunc->m_nCalls;
+
+  if (bAsync)
+  {
+    ++pFunc->m_nAsyncCalls;
+  }
+
+  if (MDZ_ERROR_NONE != enError)
+  {
+    ++pFunc->m_nErrors;
+  }
+  else
+  {
+    pFunc->m_nBytes += pCall->m_nBytes;
+  }
+
+  if (pCall->m_bTimed)
+  {
+#ifdef MDZ_EXT_STATS_SEQUENCE
+    ++pBlock->m_nSequence;
+    mdz_ext_statsFence();
+#endif
+
+    pFunc->m_nNanoseconds += nNanoseconds;
+
+#ifdef MDZ_EXT_STATS_SEQUENCE
+    mdz_ext_statsFence();
+    ++pBlock->m_nSequence;
+#endif
+  }
+
+  if (NULL != pCall->m_pDest)
+  {
+    nCapacity = mdz_ansi_capacity(pCall->m_pDest);
+    if (nCapacity > pCall->m_nCapacity && SIZE_MAX != nCapacity)
+    {
+      ++pBlock->m_oStats.m_nReallocations;
+      pBlock->m_oStats.m_nAllocatedBytes += nCapacity - pCall->m_nCapacity;
+    }
+  }
+
+  if (pCall->m_bTimed)
+  {
+    for (nBucketValue = nNanoseconds; nBucketValue >= 2 && nBucket < MDZ_ANSI_STATS_LATENCY_BUCKETS - 1; nBucketValue >>= 1)
+    {
+      ++nBucket;
+    }
+    ++pBlock->m_oStats.m_aLatency[nBucket];
+  }
+
+  pCallback = m_pStatsCallback;
+  if (NULL != pCallback)
+  {
+    pCallback->m_pfnCallback(pCall->m_enFunc, pCall->m_nBytes, nNanoseconds, enError, pCallback->m_pContext);
+  }
+}
+
+void mdz_ext_statsKernel(enum mdz_ansi_stats_kernel enKernel)
+{
+  struct mdz_ext_statsBlock* pBlock;
+
+  if (m_bStatsEnabled && NULL != (pBlock = mdz_ext_statsBlock()))
+  {
+    ++pBlock->m_oStats.m_aKernels[enKernel];
+  }
+}
+
+void mdz_ext_statsThread(mdz_bool bAsync)
+{
+  struct mdz_ext_statsBlock* pBlock;
+
+  if (m_bStatsEnabled && NULL != (pBlock = mdz_ext_statsBlock()))
+  {
+    if (bAsync)
+    {
+      ++pBlock->m_oStats.m_nAsyncThreads;
+    }
+    else
+    {
+      ++pBlock->m_oStats.m_nWorkerThreads;
+    }
+  }
+}
+
+void mdz_ext_statsRelease(void)
+{
+  struct mdz_ext_statsBlock* pBlock;
+
+  if (NULL == m_pStatsBlocks)
+  {
+    return;
+  }
+
+#ifdef _WIN32
+  pBlock = (struct mdz_ext_statsBlock*) TlsGetValue(m_nStatsTls);
+  TlsSetValue(m_nStatsTls, NULL);
+#else
+  pBlock = (struct mdz_ext_statsBlock*) pthread_getspecific(m_oStatsKey);
+  pthread_setspecific(m_oStatsKey, NULL);
+#endif
+
+  if (NULL != pBlock)
+  {
+    pBlock->m_nInUse = 0;
+  }
+}
+
+/**
+ * Return counters of pBlock. If MDZ_EXT_STATS_SEQUENCE is defined, counters are copied into pCopy, and copying is repeated until block is not changed during it
+ */
+static const struct mdz_ansi_stats* mdz_ext_statsRead(const struct mdz_ext_statsBlock* pBlock, struct mdz_ansi_stats* pCopy)
+{
+#ifdef MDZ_EXT_STATS_SEQUENCE
+  size_t nSequence;
+
+  for (;;)
+  {
+    nSequence = pBlock->m_nSequence;
+    mdz_ext_statsFence();
+
+    memcpy(pCopy, &pBlock->m_oStats, sizeof(struct mdz_ansi_stats));
+
+    mdz_ext_statsFence();
+    if (0 == (nSequence & 1) && nSequence == pBlock->m_nSequence)
+    {
+      return pCopy;
+    }
+  }
+#else
+  (void) pCopy;
+  return &pBlock->m_oStats;
+#endif
+}
+
+#endif
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_statsEnable(mdz_bool bEnable)
+{
+#ifdef MDZ_ANSI_EXT_STATS
+  if (bEnable)
+  {
+    mdz_ext_statsInit();
+  }
+
+  m_bStatsEnabled = bEnable ? 1 : 0;
+  return mdz_true;
+#else
+  (void) bEnable;
+  return mdz_false;
+#endif
+}
+
+mdz_bool mdz_ansi_statsEnableTiming(mdz_bool bEnable)
+{
+#ifdef MDZ_ANSI_EXT_STATS
+  m_bStatsTiming = bEnable ? 1 : 0;
+  return mdz_true;
+#else
+  (void) bEnable;
+  return mdz_false;
+#endif
+}
+
+mdz_bool mdz_ansi_statsSnapshot(struct mdz_ansi_stats* pStats)
+{
+#ifdef MDZ_ANSI_EXT_STATS
+  const struct mdz_ext_statsBlock* pBlock;
+  const struct mdz_ansi_stats* pBlockStats;
+  struct mdz_ansi_stats oCopy;
+  size_t i;
+
+  if (NULL == pStats)
+  {
+    return mdz_false;
+  }
+
+  memset(pStats, 0, sizeof(struct mdz_ansi_stats));
+
+  for (pBlock = m_pStatsBlocks; NULL != pBlock; pBlock = pBlock->m_pNext)
+  {
+    pBlockStats = mdz_ext_statsRead(pBlock, &oCopy);
+
+    for (i = 0; i < MDZ_ANSI_STATS_FUNC_COUNT; ++i)
+    {
+      pStats->m_aFuncs[i].m_nCalls += pBlockStats->m_aFuncs[i].m_nCalls;
+      pStats->m_aFuncs[i].m_nAsyncCalls += pBlockStats->m_aFuncs[i].m_nAsyncCalls;
+      pStats->m_aFuncs[i].m_nErrors += pBlockStats->m_aFuncs[i].m_nErrors;
+      pStats->m_aFuncs[i].m_nBytes += pBlockStats->m_aFuncs[i].m_nBytes;
+      pStats->m_aFuncs[i].m_nNanoseconds += pBlockStats->m_aFuncs[i].m_nNanoseconds;
+    }
+
+    for (i = 0; i < MDZ_ANSI_STATS_KERNEL_COUNT; ++i)
+    {
+      pStats->m_aKernels[i] += pBlockStats->m_aKernels[i];
+    }
+
+    for (i = 0; i < MDZ_ANSI_STATS_LATENCY_BUCKETS; ++i)
+    {
+      pStats->m_aLatency[i] += pBlockStats->m_aLatency[i];
+    }
+
+    pStats->m_nReallocations += pBlockStats->m_nReallocations;
+    pStats->m_nAllocatedBytes += pBlockStats->m_nAllocatedBytes;
+    pStats->m_nAsyncThreads += pBlockStats->m_nAsyncThreads;
+    pStats->m_nWorkerThreads += pBlockStats->m_nWorkerThreads;
+  }
+
+  return mdz_true;
+#else
+  (void) pStats;
+  return mdz_false;
+#endif
+}
+
+mdz_bool mdz_ansi_statsSetCallback(mdz_ansi_statsCallback pfnCallback, void* pContext)
+{
+#ifdef MDZ_ANSI_EXT_STATS
+  struct mdz_ext_statsCallbackEntry* pEntry = NULL;
+  struct mdz_ext_statsCallbackEntry* pCurrent;
+
+  if (NULL != pfnCallback)
+  {
+    for (pEntry = m_pStatsCallbacks; NULL != pEntry; pEntry = pEntry->m_pNext)
+    {
+      if (pEntry->m_pfnCallback == pfnCallback && pEntry->m_pContext == pContext)
+      {
+        break;
+      }
+    }
+
+    if (NULL == pEntry)
+    {
+      pEntry = (struct mdz_ext_statsCallbackEntry*) malloc(sizeof(struct mdz_ext_statsCallbackEntry));
+      if (NULL == pEntry)
+      {
+        return mdz_false;
+      }
+
+      pEntry->m_pfnCallback = pfnCallback;
+      pEntry->m_pContext = pContext;
+
+      do
+      {
+        pEntry->m_pNext = m_pStatsCallbacks;
+      }
+      while (!mdz_ext_casPointer(&m_pStatsCallbacks, pEntry->m_pNext, pEntry));
+    }
+  }
+
+  /* compare-and-swap is full barrier: fields of entry are visible before entry is published */
+  do
+  {
+    pCurrent = m_pStatsCallback;
+  }
+  while (!mdz_ext_casPointer(&m_pStatsCallback, pCurrent, pEntry));
+
+  return mdz_true;
+#else
+  (void) pfnCallback;
+  (void) pContext;
+  return mdz_false;
+#endif
+}
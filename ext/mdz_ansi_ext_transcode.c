@@ -0,0 +1,719 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Transcoding functions of mdz_ansi_ext: Latin-1/Windows-1252 to and from UTF-8 and UTF-16. Every conversion makes size pass and conversion pass, thus output is reserved once.
+ * ASCII runs are detected 32 bytes at a time and copied (or widened/narrowed) without per-character decoding.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+/**
+ * Code point of invalid sequence
+ */
+#define MDZ_EXT_INVALID 0xFFFFFFFFu
+
+/**
+ * Code points of Windows-1252 bytes 0x80-0x9F. Undefined bytes (0x81, 0x8D, 0x8F, 0x90, 0x9D) are mapped to C1 controls, like Windows does
+ */
+static const uint16_t m_aCp1252[32] =
+{
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+};
+
+static uint32_t mdz_ext_toCodePoint(unsigned char cItem, enum mdz_ansi_codepage enCodepage)
+{
+  if (MDZ_ANSI_CODEPAGE_WINDOWS1252 == enCodepage && cItem >= 0x80 && cItem < 0xA0)
+  {
+    return m_aCp1252[cItem - 0x80];
+  }
+
+  return cItem;
+}
+
+/**
+ * Return byte of nCodePoint in enCodepage, or -1 if nCodePoint cannot be represented
+ */
+static int mdz_ext_fromCodePoint(uint32_t nCodePoint, enum mdz_ansi_codepage enCodepage)
+{
+  int i;
+
+  if (nCodePoint < 0x80 || (nCodePoint >= 0xA0 && nCodePoint <= 0xFF))
+  {
+    return (int) nCodePoint;
+  }
+
+  if (MDZ_ANSI_CODEPAGE_LATIN1 == enCodepage)
+  {
+    return (nCodePoint <= 0xFF) ? (int) nCodePoint : -1;
+  }
+
+  for (i = 0; i < 32; ++i)
+  {
+    if (m_aCp1252[i] == nCodePoint)
+    {
+      return 0x80 + i;
+    }
+  }
+
+  return -1;
+}
+
+static mdz_bool mdz_ext_hostBigEndian(void)
+{
+  const uint16_t nValue = 1;
+
+  return (0 == *(const unsigned char*) &nValue);
+}
+
+/**
+ * \defgroup ASCII kernels. Runs are checked 32 bytes at a time
+ */
+
+static size_t mdz_ext_asciiLengthScalar(const unsigned char* pcData, size_t nSize)
+{
+  const size_t nHigh = ((size_t) -1 / 0xFF) * 0x80;
+  size_t nWord;
+  size_t i = 0;
+
+  for (; i + sizeof(nWord) <= nSize; i += sizeof(nWord))
+  {
+    memcpy(&nWord, pcData + i, sizeof(nWord));
+    if (0 != (nWord & nHigh))
+    {
+      break;
+    }
+  }
+
+  for (; i < nSize && pcData[i] < 0x80; ++i)
+  {
+  }
+
+  return i;
+}
+
+#ifdef MDZ_EXT_SSE2
+static size_t mdz_ext_asciiLengthSse2(const unsigned char* pcData, size_t nSize)
+{
+  unsigned int nMask;
+  size_t i = 0;
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    nMask = (unsigned int) _mm_movemask_epi8(_mm_or_si128(_mm_loadu_si128((const __m128i*) (pcData + i)), _mm_loadu_si128((const __m128i*) (pcData + i + 16))));
+    if (0 != nMask)
+    {
+      break;
+    }
+  }
+
+  return i + mdz_ext_asciiLengthScalar(pcData + i, nSize - i);
+}
+#endif
+
+#ifdef MDZ_EXT_AVX2
+MDZ_EXT_TARGET_AVX2
+static size_t mdz_ext_asciiLengthAvx2(const unsigned char* pcData, size_t nSize)
+{
+  unsigned int nMask;
+  size_t i = 0;
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    nMask = (unsigned int) _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*) (pcData + i)));
+    if (0 != nMask)
+    {
+      return i + mdz_ext_ctz32(nMask);
+    }
+  }
+
+  return i + mdz_ext_asciiLengthScalar(pcData + i, nSize - i);
+}
+#endif
+
+/**
+ * Return length of ASCII run at the beginning of pcData
+ */
+static size_t mdz_ext_asciiLength(const unsigned char* pcData, size_t nSize)
+{
+#ifdef MDZ_EXT_AVX2
+  if (nSize >= 64 && mdz_ext_hasAvx2())
+  {
+    return mdz_ext_asciiLengthAvx2(pcData, nSize);
+  }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+  return mdz_ext_asciiLengthSse2(pcData, nSize);
+#else
+  return mdz_ext_asciiLengthScalar(pcData, nSize);
+#endif
+}
+
+/**
+ * Return length of run of UTF-16 units < 0x80 at the beginning of pnData. Units are byte-swapped if bSwap == mdz_true
+ */
+static size_t mdz_ext_utf16AsciiLength(const uint16_t* pnData, size_t nCount, mdz_bool bSwap)
+{
+  const uint16_t nHigh = bSwap ? 0x80FF : 0xFF80;
+  size_t i = 0;
+
+#ifdef MDZ_EXT_SSE2
+  const __m128i xHigh = _mm_set1_epi16((short) nHigh);
+  __m128i xData;
+
+  for (; i + 16 <= nCount; i += 16)
+  {
+    xData = _mm_or_si128(_mm_loadu_si128((const __m128i*) (pnData + i)), _mm_loadu_si128((const __m128i*) (pnData + i + 8)));
+    if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(xData, xHigh), _mm_setzero_si128())))
+    {
+      break;
+    }
+  }
+#endif
+
+  for (; i < nCount && 0 == (pnData[i] & nHigh); ++i)
+  {
+  }
+
+  return i;
+}
+
+/**
+ * \defgroup Codecs
+ */
+
+/**
+ * Decode UTF-8 sequence at pcData. Return its length and place code point into *pnCodePoint, or MDZ_EXT_INVALID if sequence is invalid (its first byte is consumed then).
+ * Overlong sequences, surrogates and code points above 0x10FFFF are invalid
+ */
+static size_t mdz_ext_utf8Decode(const unsigned char* pcData, size_t nSize, uint32_t* pnCodePoint)
+{
+  unsigned char cFirst = pcData[0];
+  unsigned char cMin = 0x80;
+  unsigned char cMax = 0xBF;
+  size_t nLength;
+  size_t i;
+  uint32_t nCodePoint;
+
+  if (cFirst < 0x80)
+  {
+    *pnCodePoint = cFirst;
+    return 1;
+  }
+
+  if (cFirst >= 0xC2 && cFirst <= 0xDF)
+  {
+    nLength = 2;
+    nCodePoint = cFirst & 0x1F;
+  }
+  else if (cFirst >= 0xE0 && cFirst <= 0xEF)
+  {
+    nLength = 3;
+    nCodePoint = cFirst & 0x0F;
+    cMin = (0xE0 == cFirst) ? 0xA0 : 0x80;
+    cMax = (0xED == cFirst) ? 0x9F : 0xBF;
+  }
+  else if (cFirst >= 0xF0 && cFirst <= 0xF4)
+  {
+    nLength = 4;
+    nCodePoint = cFirst & 0x07;
+    cMin = (0xF0 == cFirst) ? 0x90 : 0x80;
+    cMax = (0xF4 == cFirst) ? 0x8F : 0xBF;
+  }
+  else
+  {
+    *pnCodePoint = MDZ_EXT_INVALID;
+    return 1;
+  }
+
+  if (nLength > nSize || pcData[1] < cMin || pcData[1] > cMax)
+  {
+    *pnCodePoint = MDZ_EXT_INVALID;
+    return 1;
+  }
+
+  for (i = 1; i < nLength; ++i)
+  {
+    if (0x80 != (pcData[i] & 0xC0))
+    {
+      *pnCodePoint = MDZ_EXT_INVALID;
+      return 1;
+    }
+
+    nCodePoint = (nCodePoint << 6) | (pcData[i] & 0x3F);
+  }
+
+  *pnCodePoint = nCodePoint;
+  return nLength;
+}
+
+/**
+ * Decode UTF-16 character at pnData (surrogate pair or single unit). Return number of units and place code point into *pnCodePoint, or MDZ_EXT_INVALID for unpaired surrogate
+ */
+static size_t mdz_ext_utf16Decode(const uint16_t* pnData, size_t nCount, mdz_bool bSwap, uint32_t* pnCodePoint)
+{
+  uint32_t nFirst = bSwap ? (uint16_t) (pnData[0] >> 8 | pnData[0] << 8) : pnData[0];
+  uint32_t nSecond;
+
+  if (nFirst < 0xD800 || nFirst > 0xDFFF)
+  {
+    *pnCodePoint = nFirst;
+    return 1;
+  }
+
+  if (nFirst <= 0xDBFF && nCount > 1)
+  {
+    nSecond = bSwap ? (uint16_t) (pnData[1] >> 8 | pnData[1] << 8) : pnData[1];
+    if (nSecond >= 0xDC00 && nSecond <= 0xDFFF)
+    {
+      *pnCodePoint = 0x10000 + ((nFirst - 0xD800) << 10) + (nSecond - 0xDC00);
+      return 2;
+    }
+  }
+
+  *pnCodePoint = MDZ_EXT_INVALID;
+  return 1;
+}
+
+static size_t mdz_ext_utf8Length(uint32_t nCodePoint)
+{
+  return (nCodePoint < 0x80) ? 1 : ((nCodePoint < 0x800) ? 2 : 3);
+}
+
+/**
+ * Encode nCodePoint (<= 0xFFFF) into pcOut. Return number of written bytes
+ */
+static size_t mdz_ext_utf8Encode(uint32_t nCodePoint, unsigned char* pcOut)
+{
+  if (nCodePoint < 0x80)
+  {
+    pcOut[0] = (unsigned char) nCodePoint;
+    return 1;
+  }
+
+  if (nCodePoint < 0x800)
+  {
+    pcOut[0] = (unsigned char) (0xC0 | (nCodePoint >> 6));
+    pcOut[1] = (unsigned char) (0x80 | (nCodePoint & 0x3F));
+    return 2;
+  }
+
+  pcOut[0] = (unsigned char) (0xE0 | (nCodePoint >> 12));
+  pcOut[1] = (unsigned char) (0x80 | ((nCodePoint >> 6) & 0x3F));
+  pcOut[2] = (unsigned char) (0x80 | (nCodePoint & 0x3F));
+  return 3;
+}
+
+/**
+ * \defgroup Widening into UTF-16
+ */
+
+static void mdz_ext_widenScalar(const unsigned char* pcData, size_t nSize, enum mdz_ansi_codepage enCodepage, mdz_bool bSwap, uint16_t* pnOut)
+{
+  uint16_t nUnit;
+  size_t i;
+
+  for (i = 0; i < nSize; ++i)
+  {
+    nUnit = (uint16_t) mdz_ext_toCodePoint(pcData[i], enCodepage);
+    pnOut[i] = bSwap ? (uint16_t) (nUnit >> 8 | nUnit << 8) : nUnit;
+  }
+}
+
+/**
+ * Widen nSize bytes of pcData into pnOut. Windows-1252 bytes 0x80-0x9F are mapped through table, others are zero-extended
+ */
+static void mdz_ext_widen(const unsigned char* pcData, size_t nSize, enum mdz_ansi_codepage enCodepage, mdz_bool bSwap, uint16_t* pnOut)
+{
+  size_t i = 0;
+
+#ifdef MDZ_EXT_SSE2
+  const __m128i xC1Limit = _mm_set1_epi8((char) 0xA0);
+  __m128i xLow;
+  __m128i xHigh;
+  unsigned int nC1;
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    xLow = _mm_loadu_si128((const __m128i*) (pcData + i));
+    xHigh = _mm_loadu_si128((const __m128i*) (pcData + i + 16));
+
+    /* signed compare: bytes 0x80-0x9F are less than (char) 0xA0. Such chunk is converted by scalar code */
+    if (MDZ_ANSI_CODEPAGE_WINDOWS1252 == enCodepage)
+    {
+      nC1 = (unsigned int) _mm_movemask_epi8(_mm_or_si128(_mm_cmplt_epi8(xLow, xC1Limit), _mm_cmplt_epi8(xHigh, xC1Limit)));
+      if (0 != nC1)
+      {
+        mdz_ext_widenScalar(pcData + i, 32, enCodepage, bSwap, pnOut + i);
+        continue;
+      }
+    }
+
+    /* x86 is little-endian: zero in high byte gives little-endian units, zero in low byte big-endian units */
+    if (bSwap)
+    {
+      _mm_storeu_si128((__m128i*) (pnOut + i), _mm_unpacklo_epi8(_mm_setzero_si128(), xLow));
+      _mm_storeu_si128((__m128i*) (pnOut + i + 8), _mm_unpackhi_epi8(_mm_setzero_si128(), xLow));
+      _mm_storeu_si128((__m128i*) (pnOut + i + 16), _mm_unpacklo_epi8(_mm_setzero_si128(), xHigh));
+      _mm_storeu_si128((__m128i*) (pnOut + i + 24), _mm_unpackhi_epi8(_mm_setzero_si128(), xHigh));
+    }
+    else
+    {
+      _mm_storeu_si128((__m128i*) (pnOut + i), _mm_unpacklo_epi8(xLow, _mm_setzero_si128()));
+      _mm_storeu_si128((__m128i*) (pnOut + i + 8), _mm_unpackhi_epi8(xLow, _mm_setzero_si128()));
+      _mm_storeu_si128((__m128i*) (pnOut + i + 16), _mm_unpacklo_epi8(xHigh, _mm_setzero_si128()));
+      _mm_storeu_si128((__m128i*) (pnOut + i + 24), _mm_unpackhi_epi8(xHigh, _mm_setzero_si128()));
+    }
+  }
+#endif
+
+  mdz_ext_widenScalar(pcData + i, nSize - i, enCodepage, bSwap, pnOut + i);
+}
+
+/**
+ * Narrow nCount UTF-16 units < 0x80 of pnData into pcOut
+ */
+static void mdz_ext_narrowAscii(const uint16_t* pnData, size_t nCount, mdz_bool bSwap, unsigned char* pcOut)
+{
+  size_t i = 0;
+
+#ifdef MDZ_EXT_SSE2
+  __m128i xFirst;
+  __m128i xSecond;
+
+  for (; i + 16 <= nCount; i += 16)
+  {
+    xFirst = _mm_loadu_si128((const __m128i*) (pnData + i));
+    xSecond = _mm_loadu_si128((const __m128i*) (pnData + i + 8));
+
+    if (bSwap)
+    {
+      xFirst = _mm_srli_epi16(xFirst, 8);
+      xSecond = _mm_srli_epi16(xSecond, 8);
+    }
+
+    _mm_storeu_si128((__m128i*) (pcOut + i), _mm_packus_epi16(xFirst, xSecond));
+  }
+#endif
+
+  for (; i < nCount; ++i)
+  {
+    pcOut[i] = (unsigned char) (bSwap ? pnData[i] >> 8 : pnData[i]);
+  }
+}
+
+/**
+ * \defgroup Validation
+ */
+
+static mdz_bool mdz_ext_checkCodepage(const struct mdz_Ansi* pAnsi, enum mdz_ansi_codepage enCodepage)
+{
+  if ((unsigned int) enCodepage > (unsigned int) MDZ_ANSI_CODEPAGE_WINDOWS1252)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_DATA);
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+static mdz_bool mdz_ext_checkEndianness(const struct mdz_Ansi* pAnsi, enum mdz_endianness enEndianness, mdz_bool* pbSwap)
+{
+  if (MDZ_ENDIAN_LITTLE != enEndianness && MDZ_ENDIAN_BIG != enEndianness)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_ENDIANNESS);
+    return mdz_false;
+  }
+
+  *pbSwap = ((MDZ_ENDIAN_BIG == enEndianness) != mdz_ext_hostBigEndian());
+  return mdz_true;
+}
+
+/**
+ * Replace content of pAnsi with nSize uninitialized items. Return pointer to data or NULL if reservation failed
+ */
+static unsigned char* mdz_ext_prepare(struct mdz_Ansi* pAnsi, size_t nSize)
+{
+  mdz_ansi_clear(pAnsi);
+  if (!mdz_ansi_reserve(pAnsi, nSize + 1))
+  {
+    return NULL;
+  }
+
+  return (unsigned char*) pAnsi->m_pData;
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_toUtf8(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ansi_codepage enCodepage, struct mdz_Ansi* pUtf8)
+{
+  const unsigned char* pcData;
+  unsigned char* pcOut;
+  size_t nSize;
+  size_t nOut = 0;
+  size_t nRun;
+  size_t i;
+
+  if (NULL == pAnsi)
+  {
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkSubAnsi(pAnsi, pUtf8))
+  {
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkCodepage(pAnsi, enCodepage) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  pcData = (const unsigned char*) pAnsi->m_pData + nLeftPos;
+  nSize = nRightPos - nLeftPos + 1;
+
+  for (i = 0; i < nSize; ++i)
+  {
+    nRun = mdz_ext_asciiLength(pcData + i, nSize - i);
+    nOut += nRun;
+    i += nRun;
+
+    if (i < nSize)
+    {
+      nOut += mdz_ext_utf8Length(mdz_ext_toCodePoint(pcData[i], enCodepage));
+    }
+  }
+
+  pcOut = mdz_ext_prepare(pUtf8, nOut);
+  if (NULL == pcOut)
+  {
+    return mdz_false;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  for (i = 0, nOut = 0; i < nSize; ++i)
+  {
+    nRun = mdz_ext_asciiLength(pcData + i, nSize - i);
+    memcpy(pcOut + nOut, pcData + i, nRun);
+    nOut += nRun;
+    i += nRun;
+
+    if (i < nSize)
+    {
+      nOut += mdz_ext_utf8Encode(mdz_ext_toCodePoint(pcData[i], enCodepage), pcOut + nOut);
+    }
+  }
+
+  return mdz_ansi_resize(pUtf8, nOut);
+}
+
+size_t mdz_ansi_toUtf16(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ansi_codepage enCodepage, enum mdz_endianness enEndianness, uint16_t* pnUtf16, size_t nCapacity)
+{
+  mdz_bool bSwap;
+  size_t nSize;
+
+  if (NULL == pAnsi)
+  {
+    return SIZE_MAX;
+  }
+
+  if (!mdz_ext_checkCodepage(pAnsi, enCodepage) || !mdz_ext_checkEndianness(pAnsi, enEndianness, &bSwap) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return 0;
+  }
+
+  /* every item of Latin-1 and Windows-1252 is one UTF-16 unit */
+  nSize = nRightPos - nLeftPos + 1;
+
+  if (NULL == pnUtf16 || nCapacity < nSize)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_CAPACITY);
+    return nSize;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  mdz_ext_widen((const unsigned char*) pAnsi->m_pData + nLeftPos, nSize, enCodepage, bSwap, pnUtf16);
+
+  return nSize;
+}
+
+mdz_bool mdz_ansi_fromUtf8(struct mdz_Ansi* pAnsi, const unsigned char* pcUtf8, size_t nSize, enum mdz_ansi_codepage enCodepage, char cReplacement)
+{
+  unsigned char* pcOut;
+  uint32_t nCodePoint;
+  size_t nOut = 0;
+  size_t nRun;
+  size_t i;
+  int nItem;
+  mdz_bool bReplaced = mdz_false;
+
+  if (NULL == pAnsi)
+  {
+    return mdz_false;
+  }
+
+  if (NULL == pcUtf8)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_ITEMS);
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkCodepage(pAnsi, enCodepage))
+  {
+    return mdz_false;
+  }
+
+  /* every decoded character (or invalid byte) is one item */
+  for (i = 0; i < nSize; ++nOut)
+  {
+    nRun = mdz_ext_asciiLength(pcUtf8 + i, nSize - i);
+    nOut += nRun;
+    i += nRun;
+
+    if (i == nSize)
+    {
+      break;
+    }
+
+    i += mdz_ext_utf8Decode(pcUtf8 + i, nSize - i, &nCodePoint);
+  }
+
+  pcOut = mdz_ext_prepare(pAnsi, nOut);
+  if (NULL == pcOut)
+  {
+    return mdz_false;
+  }
+
+  for (i = 0, nOut = 0; i < nSize; ++nOut)
+  {
+    nRun = mdz_ext_asciiLength(pcUtf8 + i, nSize - i);
+    memcpy(pcOut + nOut, pcUtf8 + i, nRun);
+    nOut += nRun;
+    i += nRun;
+
+    if (i == nSize)
+    {
+      break;
+    }
+
+    i += mdz_ext_utf8Decode(pcUtf8 + i, nSize - i, &nCodePoint);
+
+    nItem = (MDZ_EXT_INVALID != nCodePoint) ? mdz_ext_fromCodePoint(nCodePoint, enCodepage) : -1;
+    if (nItem < 0)
+    {
+      nItem = (unsigned char) cReplacement;
+      bReplaced = mdz_true;
+    }
+
+    pcOut[nOut] = (unsigned char) nItem;
+  }
+
+  if (!mdz_ansi_resize(pAnsi, nOut))
+  {
+    return mdz_false;
+  }
+
+  if (bReplaced)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_CONTENT);
+  }
+
+  return mdz_true;
+}
+
+mdz_bool mdz_ansi_fromUtf16(struct mdz_Ansi* pAnsi, const uint16_t* pnUtf16, size_t nCount, enum mdz_endianness enEndianness, enum mdz_ansi_codepage enCodepage, char cReplacement)
+{
+  unsigned char* pcOut;
+  uint32_t nCodePoint;
+  size_t nOut = 0;
+  size_t nRun;
+  size_t i;
+  int nItem;
+  mdz_bool bSwap;
+  mdz_bool bReplaced = mdz_false;
+
+  if (NULL == pAnsi)
+  {
+    return mdz_false;
+  }
+
+  if (NULL == pnUtf16)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_ITEMS);
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkCodepage(pAnsi, enCodepage) || !mdz_ext_checkEndianness(pAnsi, enEndianness, &bSwap))
+  {
+    return mdz_false;
+  }
+
+  /* every character (surrogate pair or single unit) is one item */
+  for (i = 0; i < nCount; ++nOut)
+  {
+    nRun = mdz_ext_utf16AsciiLength(pnUtf16 + i, nCount - i, bSwap);
+    nOut += nRun;
+    i += nRun;
+
+    if (i == nCount)
+    {
+      break;
+    }
+
+    i += mdz_ext_utf16Decode(pnUtf16 + i, nCount - i, bSwap, &nCodePoint);
+  }
+
+  pcOut = mdz_ext_prepare(pAnsi, nOut);
+  if (NULL == pcOut)
+  {
+    return mdz_false;
+  }
+
+  for (i = 0, nOut = 0; i < nCount; ++nOut)
+  {
+    nRun = mdz_ext_utf16AsciiLength(pnUtf16 + i, nCount - i, bSwap);
+    mdz_ext_narrowAscii(pnUtf16 + i, nRun, bSwap, pcOut + nOut);
+    nOut += nRun;
+    i += nRun;
+
+    if (i == nCount)
+    {
+      break;
+    }
+
+    i += mdz_ext_utf16Decode(pnUtf16 + i, nCount - i, bSwap, &nCodePoint);
+
+    nItem = (MDZ_EXT_INVALID != nCodePoint) ? mdz_ext_fromCodePoint(nCodePoint, enCodepage) : -1;
+    if (nItem < 0)
+    {
+      nItem = (unsigned char) cReplacement;
+      bReplaced = mdz_true;
+    }
+
+    pcOut[nOut] = (unsigned char) nItem;
+  }
+
+  if (!mdz_ansi_resize(pAnsi, nOut))
+  {
+    return mdz_false;
+  }
+
+  if (bReplaced)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_CONTENT);
+  }
+
+  return mdz_true;
+}
@@ -0,0 +1,1005 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Transform functions of mdz_ansi_ext: case conversion, translation using table, removal of items contained in set or of sub-strings, search of items by class.
+ * Removals are made in one pass with read and write positions: kept items are moved once, the rest of string is moved once at the end.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+enum mdz_ext_transform_type
+{
+  MDZ_EXT_TRANSFORM_LOWER = 0,
+  MDZ_EXT_TRANSFORM_UPPER = 1,
+  MDZ_EXT_TRANSFORM_TRANSLATE = 2,
+
+  /**
+   * Removal of pcItems (remove and copy-without functions). Items are not transformed, thus this type is never passed to transform kernels
+   */
+  MDZ_EXT_TRANSFORM_REMOVE = 3
+};
+
+/**
+ * If more items than this are changed by translation table, translation is made for every item without skipping
+ */
+#define MDZ_EXT_TRANSLATE_DENSE 64
+
+/**
+ * Window in bytes translated after every found item which is changed by translation table
+ */
+#define MDZ_EXT_TRANSLATE_WINDOW 64
+
+struct mdz_ext_transformContext
+{
+  unsigned char* m_pcData;
+  enum mdz_ext_transform_type m_enType;
+  const unsigned char* m_pcTable;
+  struct mdz_ext_byteSet m_oChanged;
+};
+
+/**
+ * \defgroup Case kernels. Items in [cFirst, cFirst + 25] are converted by flipping of 0x20 bit
+ */
+
+static void mdz_ext_caseScalar(unsigned char* pcData, size_t nSize, unsigned char cFirst)
+{
+  size_t i;
+
+  for (i = 0; i < nSize; ++i)
+  {
+    if ((unsigned char) (pcData[i] - cFirst) < 26)
+    {
+      pcData[i] ^= 0x20;
+    }
+  }
+}
+
+#ifdef MDZ_EXT_SSE2
+static void mdz_ext_caseSse2(unsigned char* pcData, size_t nSize, unsigned char cFirst)
+{
+  /* cFirst is shifted on -128, thus range check is one signed comparison */
+  const __m128i xShift = _mm_set1_epi8((char) (0x80 - cFirst));
+  const __m128i xLimit = _mm_set1_epi8((char) (-128 + 26));
+  const __m128i xFlip = _mm_set1_epi8(0x20);
+  __m128i xData;
+  __m128i xMatch;
+  size_t i = 0;
+
+  for (; i + 16 <= nSize; i += 16)
+  {
+    xData = _mm_loadu_si128((const __m128i*) (pcData + i));
+    xMatch = _mm_cmplt_epi8(_mm_add_epi8(xData, xShift), xLimit);
+
+    /* unchanged blocks are not written, to keep cache-lines clean */
+    if (0 != _mm_movemask_epi8(xMatch))
+    {
+      _mm_storeu_si128((__m128i*) (pcData + i), _mm_xor_si128(xData, _mm_and_si128(xMatch, xFlip)));
+    }
+  }
+
+  mdz_ext_caseScalar(pcData + i, nSize - i, cFirst);
+}
+#endif
+
+#ifdef MDZ_EXT_AVX2
+MDZ_EXT_TARGET_AVX2
+static void mdz_ext_caseAvx2(unsigned char* pcData, size_t nSize, unsigned char cFirst)
+{
+  const __m256i yShift = _mm256_set1_epi8((char) (0x80 - cFirst));
+  const __m256i yLimit = _mm256_set1_epi8((char) (-128 + 26));
+  const __m256i yFlip = _mm256_set1_epi8(0x20);
+  __m256i yData;
+  __m256i yMatch;
+  size_t i = 0;
+
+  for (; i + 32 <= nSize; i += 32)
+  {
+    yData = _mm256_loadu_si256((const __m256i*) (pcData + i));
+    yMatch = _mm256_cmpgt_epi8(yLimit, _mm256_add_epi8(yData, yShift));
+
+    if (0 != _mm256_movemask_epi8(yMatch))
+    {
+      _mm256_storeu_si256((__m256i*) (pcData + i), _mm256_xor_si256(yData, _mm256_and_si256(yMatch, yFlip)));
+    }
+  }
+
+  mdz_ext_caseScalar(pcData + i, nSize - i, cFirst);
+}
+#endif
+
+static void mdz_ext_case(unsigned char* pcData, size_t nSize, unsigned char cFirst)
+{
+#ifdef MDZ_EXT_AVX2
+  if (nSize >= 64 && mdz_ext_hasAvx2())
+  {
+    mdz_ext_caseAvx2(pcData, nSize, cFirst);
+    return;
+  }
+#endif
+
+#ifdef MDZ_EXT_SSE2
+  mdz_ext_caseSse2(pcData, nSize, cFirst);
+#else
+  mdz_ext_caseScalar(pcData, nSize, cFirst);
+#endif
+}
+
+/**
+ * \defgroup Translation kernel
+ */
+
+static void mdz_ext_translateScalar(unsigned char* pcData, size_t nSize, const unsigned char* pcTable)
+{
+  size_t i = 0;
+
+  for (; i + 4 <= nSize; i += 4)
+  {
+    pcData[i] = pcTable[pcData[i]];
+    pcData[i + 1] = pcTable[pcData[i + 1]];
+    pcData[i + 2] = pcTable[pcData[i + 2]];
+    pcData[i + 3] = pcTable[pcData[i + 3]];
+  }
+
+  for (; i < nSize; ++i)
+  {
+    pcData[i] = pcTable[pcData[i]];
+  }
+}
+
+static void mdz_ext_translate(unsigned char* pcData, size_t nSize, const unsigned char* pcTable, const struct mdz_ext_byteSet* pChanged)
+{
+  size_t nPos = 0;
+  size_t nWindow;
+
+  if (pChanged->m_nCount > MDZ_EXT_TRANSLATE_DENSE)
+  {
+    mdz_ext_translateScalar(pcData, nSize, pcTable);
+    return;
+  }
+
+  while (nPos < nSize)
+  {
+    nPos += mdz_ext_byteSetFirst(pChanged, pcData + nPos, nSize - nPos, mdz_true);
+    if (nPos >= nSize)
+    {
+      break;
+    }
+
+    /* translation of unchanged items is harmless, thus whole window is translated */
+    nWindow = (nSize - nPos > MDZ_EXT_TRANSLATE_WINDOW) ? MDZ_EXT_TRANSLATE_WINDOW : nSize - nPos;
+    mdz_ext_translateScalar(pcData + nPos, nWindow, pcTable);
+    nPos += nWindow;
+  }
+}
+
+static void mdz_ext_transformRange(void* pContext, size_t nFrom, size_t nTo)
+{
+  struct mdz_ext_transformContext* pTransform = (struct mdz_ext_transformContext*) pContext;
+
+  switch (pTransform->m_enType)
+  {
+  case MDZ_EXT_TRANSFORM_LOWER:
+    mdz_ext_case(pTransform->m_pcData + nFrom, nTo - nFrom, 'A');
+    break;
+  case MDZ_EXT_TRANSFORM_UPPER:
+    mdz_ext_case(pTransform->m_pcData + nFrom, nTo - nFrom, 'a');
+    break;
+  case MDZ_EXT_TRANSFORM_TRANSLATE:
+    mdz_ext_translate(pTransform->m_pcData + nFrom, nTo - nFrom, pTransform->m_pcTable, &pTransform->m_oChanged);
+    break;
+  case MDZ_EXT_TRANSFORM_REMOVE:
+    break;
+  }
+}
+
+/**
+ * Transform nSize items of pcData. Return nSize, or number of transformed items from start of pcData if call is cancelled
+ */
+static size_t mdz_ext_transformData(char* pcData, size_t nSize, enum mdz_ext_transform_type enType, const unsigned char* pcTable, const struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_transformContext oTransform;
+  size_t i;
+
+  oTransform.m_pcData = (unsigned char*) pcData;
+  oTransform.m_enType = enType;
+  oTransform.m_pcTable = pcTable;
+
+  if (MDZ_EXT_TRANSFORM_TRANSLATE == enType)
+  {
+    mdz_ext_byteSetInit(&oTransform.m_oChanged, NULL, 0);
+
+    for (i = 0; i < 256; ++i)
+    {
+      if (pcTable[i] != (unsigned char) i)
+      {
+        mdz_ext_byteSetAdd(&oTransform.m_oChanged, (unsigned char) i);
+      }
+    }
+
+    if (0 == oTransform.m_oChanged.m_nCount)
+    {
+      return nSize;
+    }
+  }
+
+  return mdz_ext_processRange(nSize, 1, mdz_ext_transformRange, &oTransform, pAsyncData);
+}
+
+/**
+ * \defgroup Classes of items
+ */
+
+static unsigned int mdz_ext_classOf(unsigned char cItem)
+{
+  unsigned int nClass;
+
+  if (cItem >= 128)
+  {
+    return MDZ_ANSI_CLASS_HIGH;
+  }
+
+  if (cItem < 32 || 127 == cItem)
+  {
+    return (cItem >= '\t' && cItem <= '\r') ? (MDZ_ANSI_CLASS_CNTRL | MDZ_ANSI_CLASS_SPACE) : MDZ_ANSI_CLASS_CNTRL;
+  }
+
+  if (' ' == cItem)
+  {
+    return MDZ_ANSI_CLASS_SPACE;
+  }
+
+  if (cItem >= 'a' && cItem <= 'z')
+  {
+    nClass = MDZ_ANSI_CLASS_LOWER;
+  }
+  else if (cItem >= 'A' && cItem <= 'Z')
+  {
+    nClass = MDZ_ANSI_CLASS_UPPER;
+  }
+  else if (cItem >= '0' && cItem <= '9')
+  {
+    return MDZ_ANSI_CLASS_DIGIT | MDZ_ANSI_CLASS_XDIGIT;
+  }
+  else
+  {
+    return MDZ_ANSI_CLASS_PUNCT;
+  }
+
+  return ((cItem | 0x20) <= 'f') ? (nClass | MDZ_ANSI_CLASS_XDIGIT) : nClass;
+}
+
+/**
+ * Fill pcItems with items of nClasses in increasing order. Return number of items
+ */
+static size_t mdz_ext_classItems(unsigned int nClasses, unsigned char* pcItems)
+{
+  size_t nCount = 0;
+  size_t i;
+
+  for (i = 0; i < 256; ++i)
+  {
+    if (mdz_ext_classOf((unsigned char) i) & nClasses)
+    {
+      pcItems[nCount++] = (unsigned char) i;
+    }
+  }
+
+  return nCount;
+}
+
+/**
+ * \defgroup Implementation of calls
+ */
+
+/**
+ * If call is cancelled, implementations of calls set *pnResume to position, from which call can be repeated to complete it. pnResume is not used if pAsyncData is NULL
+ */
+
+static mdz_bool mdz_ext_transformAnsi(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ext_transform_type enType, const unsigned char* pcTable, const struct mdz_asyncData* pAsyncData, size_t* pnResume)
+{
+  size_t nProcessed;
+
+  if (MDZ_EXT_TRANSFORM_TRANSLATE == enType && NULL == pcTable)
+  {
+    pAnsi->m_enErrorCode = MDZ_ERROR_ITEMS;
+    return mdz_true;
+  }
+
+  if (!mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  pAnsi->m_enErrorCode = MDZ_ERROR_NONE;
+
+  nProcessed = mdz_ext_transformData(pAnsi->m_pData + nLeftPos, nRightPos - nLeftPos + 1, enType, pcTable, pAsyncData);
+  if (nProcessed < nRightPos - nLeftPos + 1)
+  {
+    *pnResume = nLeftPos + nProcessed;
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+static size_t mdz_ext_removeAnyOfAnsi(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, const struct mdz_asyncData* pAsyncData, mdz_bool* pbFinished, size_t* pnResume)
+{
+  struct mdz_ext_byteSet oSet;
+  unsigned char* pcData;
+  size_t nEnd;
+  size_t nPos;
+  size_t nWrite;
+
+  *pbFinished = mdz_true;
+
+  if (!mdz_ext_checkItems(pAnsi, pcItems, &nCount) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return 0;
+  }
+
+  pAnsi->m_enErrorCode = MDZ_ERROR_NONE;
+
+  mdz_ext_byteSetInit(&oSet, (const unsigned char*) pcItems, nCount);
+
+  pcData = (unsigned char*) pAnsi->m_pData;
+  nEnd = nRightPos + 1;
+  nPos = nLeftPos;
+  nWrite = nLeftPos;
+
+  while (nPos < nEnd)
+  {
+    if (mdz_ext_isCancelled(pAsyncData))
+    {
+      *pbFinished = mdz_false;
+      *pnResume = nWrite;
+      break;
+    }
+
+    nRightPos = (nEnd - nPos > MDZ_ANSI_EXT_CANCEL_CHUNK) ? nPos + MDZ_ANSI_EXT_CANCEL_CHUNK : nEnd;
+    nWrite = mdz_ext_byteSetCompact(&oSet, pcData, nWrite, pcData, nPos, nRightPos);
+    nPos = nRightPos;
+  }
+
+  /* gap between compacted and not processed items is closed with one move of the rest of string */
+  if (nPos > nWrite)
+  {
+    mdz_ansi_removeFrom(pAnsi, nWrite, nPos - nWrite);
+  }
+
+  return nPos - nWrite;
+}
+
+static size_t mdz_ext_removeAllAnsi(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, const struct mdz_asyncData* pAsyncData, mdz_bool* pbFinished, size_t* pnResume)
+{
+  mdz_ext_findFunc pfnFind;
+  unsigned char* pcData;
+  size_t nEnd;
+  size_t nRead;
+  size_t nWrite;
+  size_t nLimit;
+  size_t nFound;
+  size_t nRemoved = 0;
+
+  *pbFinished = mdz_true;
+
+  if (!mdz_ext_checkItems(pAnsi, pcItems, &nCount) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return 0;
+  }
+
+  if (nCount > nRightPos - nLeftPos + 1)
+  {
+    pAnsi->m_enErrorCode = MDZ_ERROR_BIGCOUNT;
+    return 0;
+  }
+
+  pAnsi->m_enErrorCode = MDZ_ERROR_NONE;
+
+  pcData = (unsigned char*) pAnsi->m_pData;
+  nEnd = nRightPos + 1;
+  nRead = nLeftPos;
+  nWrite = nLeftPos;
+
+  /* kernel is selected once for the whole range, not for every match */
+  pfnFind = mdz_ext_findSelect(nEnd - nLeftPos, nCount);
+  mdz_ext_statsKernel(mdz_ext_findKernel(nEnd - nLeftPos, nCount, mdz_false));
+
+  while (nRead < nEnd)
+  {
+    if (mdz_ext_isCancelled(pAsyncData))
+    {
+      *pbFinished = mdz_false;
+      *pnResume = nWrite;
+      break;
+    }
+
+    /* search window overlaps next one on nCount-1 items, thus matches on window border are found */
+    nLimit = (nEnd - nRead > MDZ_ANSI_EXT_CANCEL_CHUNK + nCount - 1) ? nRead + MDZ_ANSI_EXT_CANCEL_CHUNK + nCount - 1 : nEnd;
+    nFound = (nLimit - nRead >= nCount) ? pfnFind(pcData + nRead, nLimit - nRead, (const unsigned char*) pcItems, nCount) : nLimit - nRead;
+
+    if (nFound >= nLimit - nRead)
+    {
+      nFound = (nLimit == nEnd) ? nEnd - nRead : nLimit - nRead - (nCount - 1);
+      nLimit = nRead + nFound;
+    }
+    else
+    {
+      nLimit = nRead + nFound + nCount;
+      ++nRemoved;
+    }
+
+    if (nWrite != nRead && nFound > 0)
+    {
+      memmove(pcData + nWrite, pcData + nRead, nFound);
+    }
+
+    nWrite += nFound;
+    nRead = nLimit;
+  }
+
+  if (nRead > nWrite)
+  {
+    mdz_ansi_removeFrom(pAnsi, nWrite, nRead - nWrite);
+  }
+
+  return nRemoved;
+}
+
+static mdz_bool mdz_ext_copyTransformed(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ext_transform_type enType, const unsigned char* pcTable, struct mdz_Ansi* pSubAnsi,
+                                        const struct mdz_asyncData* pAsyncData, size_t* pnResume)
+{
+  size_t nSize;
+  size_t nDone;
+  size_t nChunk;
+
+  if (!mdz_ext_checkSubAnsi(pAnsi, pSubAnsi))
+  {
+    return mdz_false;
+  }
+
+  if (MDZ_EXT_TRANSFORM_TRANSLATE == enType && NULL == pcTable)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_ITEMS);
+    return mdz_true;
+  }
+
+  if (!mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  nSize = nRightPos - nLeftPos + 1;
+
+  mdz_ansi_clear(pSubAnsi);
+  if (!mdz_ansi_reserve(pSubAnsi, nSize + 1))
+  {
+    return mdz_false;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  /* asynchronous call copies in chunks, thus m_bCancel is checked during copying too */
+  for (nDone = 0; nDone < nSize; nDone += nChunk)
+  {
+    if (mdz_ext_isCancelled(pAsyncData))
+    {
+      mdz_ansi_clear(pSubAnsi);
+      *pnResume = nLeftPos;
+      return mdz_false;
+    }
+
+    nChunk = (NULL == pAsyncData || nSize - nDone < MDZ_ANSI_EXT_CANCEL_CHUNK) ? nSize - nDone : MDZ_ANSI_EXT_CANCEL_CHUNK;
+    if (!mdz_ansi_insert(pSubAnsi, nDone, pAnsi->m_pData + nLeftPos + nDone, nChunk, mdz_true))
+    {
+      return mdz_false;
+    }
+  }
+
+  /* not transformed part is removed, thus pSubAnsi contains result for [nLeftPos, *pnResume) */
+  nDone = mdz_ext_transformData(pSubAnsi->m_pData, nSize, enType, pcTable, pAsyncData);
+  if (nDone < nSize)
+  {
+    mdz_ansi_removeFrom(pSubAnsi, nDone, nSize - nDone);
+    *pnResume = nLeftPos + nDone;
+    return mdz_false;
+  }
+
+  return mdz_true;
+}
+
+static mdz_bool mdz_ext_copyWithoutAnyOf(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_Ansi* pSubAnsi,
+                                         const struct mdz_asyncData* pAsyncData, size_t* pnResume)
+{
+  struct mdz_ext_byteSet oSet;
+  const unsigned char* pcData;
+  size_t nEnd;
+  size_t nChunkEnd;
+  size_t nWritten = 0;
+
+  if (!mdz_ext_checkSubAnsi(pAnsi, pSubAnsi))
+  {
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkItems(pAnsi, pcItems, &nCount) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_true;
+  }
+
+  mdz_ansi_clear(pSubAnsi);
+  if (!mdz_ansi_reserve(pSubAnsi, nRightPos - nLeftPos + 2))
+  {
+    return mdz_false;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  mdz_ext_byteSetInit(&oSet, (const unsigned char*) pcItems, nCount);
+
+  pcData = (const unsigned char*) pAnsi->m_pData;
+  nEnd = nRightPos + 1;
+
+  /* kept items are compacted directly into reserved data of pSubAnsi, thus source is read only once. m_bCancel is checked every chunk */
+  while (nLeftPos < nEnd)
+  {
+    if (mdz_ext_isCancelled(pAsyncData))
+    {
+      mdz_ansi_resize(pSubAnsi, nWritten);
+      *pnResume = nLeftPos;
+      return mdz_false;
+    }
+
+    nChunkEnd = (nEnd - nLeftPos > MDZ_ANSI_EXT_CANCEL_CHUNK) ? nLeftPos + MDZ_ANSI_EXT_CANCEL_CHUNK : nEnd;
+    nWritten = mdz_ext_byteSetCompact(&oSet, (unsigned char*) pSubAnsi->m_pData, nWritten, pcData, nLeftPos, nChunkEnd);
+    nLeftPos = nChunkEnd;
+  }
+
+  mdz_ansi_resize(pSubAnsi, nWritten);
+
+  return mdz_true;
+}
+
+/**
+ * Return 0-based position of first item between nLeftPos and nRightPos, which belongs (or does not belong if bMember == mdz_false) to nClasses, or Size if not found or parameters are invalid.
+ * If call is cancelled, mdz_false is set into *pbFinished and new nLeftPos to resume search from is returned. pbFinished is not used if pAsyncData is NULL
+ */
+static size_t mdz_ext_findClassAnsi(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, unsigned int nClasses, mdz_bool bMember, const struct mdz_asyncData* pAsyncData, mdz_bool* pbFinished)
+{
+  unsigned char aItems[256];
+  struct mdz_ext_byteSet oSet;
+  const unsigned char* pcData;
+  size_t nChunk;
+  size_t nEnd;
+  size_t nChunkEnd;
+  size_t nFound;
+
+  if (0 == (nClasses & 0xFF))
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_ITEMS);
+    return mdz_ansi_size(pAnsi);
+  }
+
+  if (!mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_ansi_size(pAnsi);
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  mdz_ext_byteSetInit(&oSet, aItems, mdz_ext_classItems(nClasses, aItems));
+
+  pcData = (const unsigned char*) pAnsi->m_pData;
+  nChunk = (NULL == pAsyncData) ? nRightPos - nLeftPos + 1 : MDZ_ANSI_EXT_CANCEL_CHUNK;
+  nEnd = nRightPos + 1;
+
+  for (; nLeftPos < nEnd; nLeftPos = nChunkEnd)
+  {
+    if (mdz_ext_isCancelled(pAsyncData))
+    {
+      *pbFinished = mdz_false;
+      return nLeftPos;
+    }
+
+    nChunkEnd = (nEnd - nLeftPos > nChunk) ? nLeftPos + nChunk : nEnd;
+    nFound = mdz_ext_byteSetFirst(&oSet, pcData + nLeftPos, nChunkEnd - nLeftPos, bMember);
+    if (nFound < nChunkEnd - nLeftPos)
+    {
+      return nLeftPos + nFound;
+    }
+  }
+
+  return mdz_ansi_size(pAnsi);
+}
+
+/**
+ * \defgroup Asynchronous calls
+ */
+
+struct mdz_ext_transformArgs
+{
+  const struct mdz_Ansi* m_pAnsi;
+  size_t m_nLeftPos;
+  size_t m_nRightPos;
+  enum mdz_ext_transform_type m_enType;
+  const unsigned char* m_pcTable;
+  const char* m_pcItems;
+  size_t m_nCount;
+  struct mdz_Ansi* m_pSubAnsi;
+};
+
+static struct mdz_ext_transformArgs* mdz_ext_transformArgsCreate(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ext_transform_type enType, const unsigned char* pcTable,
+                                                                 const char* pcItems, size_t nCount, struct mdz_Ansi* pSubAnsi)
+{
+  struct mdz_ext_transformArgs* pArgs = (struct mdz_ext_transformArgs*) malloc(sizeof(struct mdz_ext_transformArgs));
+
+  if (NULL != pArgs)
+  {
+    pArgs->m_pAnsi = pAnsi;
+    pArgs->m_nLeftPos = nLeftPos;
+    pArgs->m_nRightPos = nRightPos;
+    pArgs->m_enType = enType;
+    pArgs->m_pcTable = pcTable;
+    pArgs->m_pcItems = pcItems;
+    pArgs->m_nCount = nCount;
+    pArgs->m_pSubAnsi = pSubAnsi;
+  }
+
+  return pArgs;
+}
+
+static mdz_bool mdz_ext_transformAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_transformArgs* pArgs = (struct mdz_ext_transformArgs*) pParam;
+  size_t nResume;
+  mdz_bool bFinished = mdz_ext_transformAnsi((struct mdz_Ansi*) pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_enType, pArgs->m_pcTable, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = bFinished ? (size_t) mdz_true : nResume;
+  return bFinished;
+}
+
+static mdz_bool mdz_ext_removeAnyOfAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_transformArgs* pArgs = (struct mdz_ext_transformArgs*) pParam;
+  size_t nResume;
+  mdz_bool bFinished;
+  size_t nRemoved = mdz_ext_removeAnyOfAnsi((struct mdz_Ansi*) pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pcItems, pArgs->m_nCount, pAsyncData, &bFinished, &nResume);
+
+  pAsyncData->m_nResult = bFinished ? nRemoved : nResume;
+  return bFinished;
+}
+
+static mdz_bool mdz_ext_removeAllAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_transformArgs* pArgs = (struct mdz_ext_transformArgs*) pParam;
+  size_t nResume;
+  mdz_bool bFinished;
+  size_t nRemoved = mdz_ext_removeAllAnsi((struct mdz_Ansi*) pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pcItems, pArgs->m_nCount, pAsyncData, &bFinished, &nResume);
+
+  pAsyncData->m_nResult = bFinished ? nRemoved : nResume;
+  return bFinished;
+}
+
+static mdz_bool mdz_ext_copyTransformedAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_transformArgs* pArgs = (struct mdz_ext_transformArgs*) pParam;
+  size_t nResume = SIZE_MAX;
+  mdz_bool bRet = mdz_ext_copyTransformed(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_enType, pArgs->m_pcTable, pArgs->m_pSubAnsi, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = (SIZE_MAX == nResume) ? (size_t) bRet : nResume;
+  return (SIZE_MAX == nResume);
+}
+
+static mdz_bool mdz_ext_copyWithoutAnyOfAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_transformArgs* pArgs = (struct mdz_ext_transformArgs*) pParam;
+  size_t nResume = SIZE_MAX;
+  mdz_bool bRet = mdz_ext_copyWithoutAnyOf(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pcItems, pArgs->m_nCount, pArgs->m_pSubAnsi, pAsyncData, &nResume);
+
+  pAsyncData->m_nResult = (SIZE_MAX == nResume) ? (size_t) bRet : nResume;
+  return (SIZE_MAX == nResume);
+}
+
+struct mdz_ext_findClassArgs
+{
+  const struct mdz_Ansi* m_pAnsi;
+  size_t m_nLeftPos;
+  size_t m_nRightPos;
+  unsigned int m_nClasses;
+  mdz_bool m_bMember;
+};
+
+static mdz_bool mdz_ext_findClassAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_findClassArgs* pArgs = (struct mdz_ext_findClassArgs*) pParam;
+  mdz_bool bFinished = mdz_true;
+
+  pAsyncData->m_nResult = mdz_ext_findClassAnsi(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_nClasses, pArgs->m_bMember, pAsyncData, &bFinished);
+
+  return bFinished;
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_toLower_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_TOLOWER, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_transformAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_LOWER, NULL, NULL, 0, NULL), &oStatsCall);
+  }
+
+  bRet = mdz_ext_transformAnsi(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_LOWER, NULL, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_toUpper_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_TOUPPER, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_transformAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_UPPER, NULL, NULL, 0, NULL), &oStatsCall);
+  }
+
+  bRet = mdz_ext_transformAnsi(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_UPPER, NULL, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_translate_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const unsigned char* pcTable, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_TRANSLATE, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_transformAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_TRANSLATE, pcTable, NULL, 0, NULL), &oStatsCall);
+  }
+
+  bRet = mdz_ext_transformAnsi(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_TRANSLATE, pcTable, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_removeAnyOf_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bFinished;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_REMOVEANYOF, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_removeAnyOfAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_REMOVE, NULL, pcItems, nCount, NULL), &oStatsCall);
+  }
+
+  mdz_ext_removeAnyOfAnsi(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL, &bFinished, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return mdz_true;
+}
+
+mdz_bool mdz_ansi_removeAll_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bFinished;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_REMOVEALL, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_removeAllAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_REMOVE, NULL, pcItems, nCount, NULL), &oStatsCall);
+  }
+
+  mdz_ext_removeAllAnsi(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL, &bFinished, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return mdz_true;
+}
+
+mdz_bool mdz_ansi_copyLower_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_COPYLOWER, pAnsi, nLeftPos, nRightPos, pSubAnsi);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_copyTransformedAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_LOWER, NULL, NULL, 0, pSubAnsi), &oStatsCall);
+  }
+
+  bRet = mdz_ext_copyTransformed(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_LOWER, NULL, pSubAnsi, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_copyUpper_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_COPYUPPER, pAnsi, nLeftPos, nRightPos, pSubAnsi);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_copyTransformedAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_UPPER, NULL, NULL, 0, pSubAnsi), &oStatsCall);
+  }
+
+  bRet = mdz_ext_copyTransformed(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_UPPER, NULL, pSubAnsi, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_copyTranslated_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const unsigned char* pcTable, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_COPYTRANSLATED, pAnsi, nLeftPos, nRightPos, pSubAnsi);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_copyTransformedAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_TRANSLATE, pcTable, NULL, 0, pSubAnsi), &oStatsCall);
+  }
+
+  bRet = mdz_ext_copyTransformed(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_TRANSLATE, pcTable, pSubAnsi, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+mdz_bool mdz_ansi_copyWithoutAnyOf_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_COPYWITHOUTANYOF, pAnsi, nLeftPos, nRightPos, pSubAnsi);
+
+  if (NULL != pAsyncData)
+  {
+    return mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_copyWithoutAnyOfAsync,
+                              mdz_ext_transformArgsCreate(pAnsi, nLeftPos, nRightPos, MDZ_EXT_TRANSFORM_REMOVE, NULL, pcItems, nCount, pSubAnsi), &oStatsCall);
+  }
+
+  bRet = mdz_ext_copyWithoutAnyOf(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pSubAnsi, NULL, NULL);
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
+
+size_t mdz_ansi_findClass_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, unsigned int nClasses, mdz_bool bMember, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  struct mdz_ext_findClassArgs* pArgs;
+  size_t nRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return SIZE_MAX;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_FINDCLASS, pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL == pAsyncData)
+  {
+    nRet = mdz_ext_findClassAnsi(pAnsi, nLeftPos, nRightPos, nClasses, bMember, NULL, NULL);
+    mdz_ext_statsEnd(&oStatsCall, mdz_false);
+    return nRet;
+  }
+
+  pArgs = (struct mdz_ext_findClassArgs*) malloc(sizeof(struct mdz_ext_findClassArgs));
+  if (NULL != pArgs)
+  {
+    pArgs->m_pAnsi = pAnsi;
+    pArgs->m_nLeftPos = nLeftPos;
+    pArgs->m_nRightPos = nRightPos;
+    pArgs->m_nClasses = nClasses;
+    pArgs->m_bMember = bMember;
+  }
+
+  if (!mdz_ext_startAsync((struct mdz_Ansi*) pAnsi, pAsyncData, mdz_ext_findClassAsync, pArgs, &oStatsCall))
+  {
+    return SIZE_MAX;
+  }
+
+  return mdz_ansi_size(pAnsi);
+}
+
+size_t mdz_ansi_classItems(unsigned int nClasses, char* pcItems)
+{
+  if (NULL == pcItems)
+  {
+    return 0;
+  }
+
+  return mdz_ext_classItems(nClasses, (unsigned char*) pcItems);
+}
+
+void mdz_ansi_toLowerUnchecked(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos)
+{
+  mdz_ext_case((unsigned char*) pAnsi->m_pData + nLeftPos, nRightPos - nLeftPos + 1, 'A');
+}
+
+void mdz_ansi_toUpperUnchecked(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos)
+{
+  mdz_ext_case((unsigned char*) pAnsi->m_pData + nLeftPos, nRightPos - nLeftPos + 1, 'a');
+}
@@ -0,0 +1,280 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * Trim functions of mdz_ansi_ext: bounds of trimmed items are found using byte-set SIMD scans, data is moved at most once.
+ *
+ */
+
+#include "mdz_ansi_ext_internal.h"
+
+enum mdz_ext_trim_type
+{
+  MDZ_EXT_TRIM_LEFT = 1,
+  MDZ_EXT_TRIM_RIGHT = 2,
+  MDZ_EXT_TRIM_BOTH = 3
+};
+
+/**
+ * Return 0-based position of first (or last if bReverse == mdz_true) item in [nFrom, nTo) not contained in pSet, or nTo if all items are contained.
+ * If pAsyncData is not NULL, m_bCancel is checked every MDZ_ANSI_EXT_CANCEL_CHUNK bytes and *pbCancelled is set if cancelled
+ */
+static size_t mdz_ext_trimScan(const struct mdz_ext_byteSet* pSet, const unsigned char* pcData, size_t nFrom, size_t nTo, mdz_bool bReverse, const struct mdz_asyncData* pAsyncData, mdz_bool* pbCancelled)
+{
+  size_t nChunk = (NULL == pAsyncData) ? nTo - nFrom : MDZ_ANSI_EXT_CANCEL_CHUNK;
+  size_t nStart;
+  size_t nEnd;
+  size_t nFound;
+
+  *pbCancelled = mdz_false;
+
+  if (!bReverse)
+  {
+    for (nStart = nFrom; nStart < nTo; nStart = nEnd)
+    {
+      if (mdz_ext_isCancelled(pAsyncData))
+      {
+        *pbCancelled = mdz_true;
+        return nTo;
+      }
+
+      nEnd = (nTo - nStart > nChunk) ? nStart + nChunk : nTo;
+      nFound = mdz_ext_byteSetFirst(pSet, pcData + nStart, nEnd - nStart, mdz_false);
+      if (nFound < nEnd - nStart)
+      {
+        return nStart + nFound;
+      }
+    }
+  }
+  else
+  {
+    for (nEnd = nTo; nEnd > nFrom; nEnd = nStart)
+    {
+      if (mdz_ext_isCancelled(pAsyncData))
+      {
+        *pbCancelled = mdz_true;
+        return nTo;
+      }
+
+      nStart = (nEnd - nFrom > nChunk) ? nEnd - nChunk : nFrom;
+      nFound = mdz_ext_byteSetLast(pSet, pcData + nStart, nEnd - nStart, mdz_false);
+      if (nFound < nEnd - nStart)
+      {
+        return nStart + nFound;
+      }
+    }
+  }
+
+  return nTo;
+}
+
+/**
+ * Find bounds of range after trimming. Return mdz_false if parameters are invalid or call is cancelled.
+ * If all items are trimmed, *pnFirst is nRightPos + 1 and *pnLast is nRightPos
+ */
+static mdz_bool mdz_ext_trimFind(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, enum mdz_ext_trim_type enType,
+                                 size_t* pnFirst, size_t* pnLast, const struct mdz_asyncData* pAsyncData, mdz_bool* pbCancelled)
+{
+  struct mdz_ext_byteSet oSet;
+  const unsigned char* pcData;
+  size_t nEnd;
+
+  *pbCancelled = mdz_false;
+
+  if (0 == mdz_ansi_size(pAnsi))
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_EMPTY);
+    return mdz_false;
+  }
+
+  if (!mdz_ext_checkItems(pAnsi, pcItems, &nCount) || !mdz_ext_checkRange(pAnsi, nLeftPos, &nRightPos))
+  {
+    return mdz_false;
+  }
+
+  mdz_ext_setError(pAnsi, MDZ_ERROR_NONE);
+
+  mdz_ext_byteSetInit(&oSet, (const unsigned char*) pcItems, nCount);
+
+  pcData = (const unsigned char*) pAnsi->m_pData;
+  nEnd = nRightPos + 1;
+
+  *pnFirst = nLeftPos;
+  *pnLast = nRightPos;
+
+  /* right bound is searched first: if nothing remains, left scan is not necessary */
+  if (enType & MDZ_EXT_TRIM_RIGHT)
+  {
+    *pnLast = mdz_ext_trimScan(&oSet, pcData, nLeftPos, nEnd, mdz_true, pAsyncData, pbCancelled);
+    if (*pbCancelled)
+    {
+      return mdz_false;
+    }
+
+    if (*pnLast == nEnd)
+    {
+      *pnFirst = nEnd;
+      *pnLast = nRightPos;
+      return mdz_true;
+    }
+  }
+
+  if (enType & MDZ_EXT_TRIM_LEFT)
+  {
+    *pnFirst = mdz_ext_trimScan(&oSet, pcData, nLeftPos, *pnLast + 1, mdz_false, pAsyncData, pbCancelled);
+    if (*pbCancelled)
+    {
+      return mdz_false;
+    }
+  }
+
+  return mdz_true;
+}
+
+static mdz_bool mdz_ext_trimAnsi(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, enum mdz_ext_trim_type enType, const struct mdz_asyncData* pAsyncData)
+{
+  size_t nSize;
+  size_t nFirst;
+  size_t nLast;
+  size_t nKept;
+  mdz_bool bCancelled;
+
+  if (!mdz_ext_trimFind(pAnsi, nLeftPos, nRightPos, pcItems, nCount, enType, &nFirst, &nLast, pAsyncData, &bCancelled))
+  {
+    return !bCancelled;
+  }
+
+  nSize = mdz_ansi_size(pAnsi);
+  if (SIZE_MAX == nRightPos)
+  {
+    nRightPos = nSize - 1;
+  }
+
+  nKept = nLast + 1 - nFirst;
+  if (nFirst == nLeftPos && nLast == nRightPos)
+  {
+    return mdz_true;
+  }
+
+  /* both bounds are known, thus every kept item and every item after nRightPos (with terminating 0) is moved at most once, and Size is set once */
+  if (nFirst > nLeftPos && nKept > 0)
+  {
+    memmove(pAnsi->m_pData + nLeftPos, pAnsi->m_pData + nFirst, nKept);
+  }
+
+  memmove(pAnsi->m_pData + nLeftPos + nKept, pAnsi->m_pData + nRightPos + 1, nSize - nRightPos);
+  mdz_ansi_resize(pAnsi, nSize - (nRightPos - nLeftPos + 1 - nKept));
+
+  return mdz_true;
+}
+
+struct mdz_ext_trimArgs
+{
+  struct mdz_Ansi* m_pAnsi;
+  size_t m_nLeftPos;
+  size_t m_nRightPos;
+  const char* m_pcItems;
+  size_t m_nCount;
+  enum mdz_ext_trim_type m_enType;
+};
+
+static mdz_bool mdz_ext_trimAsync(void* pParam, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_trimArgs* pArgs = (struct mdz_ext_trimArgs*) pParam;
+  mdz_bool bRet = mdz_ext_trimAnsi(pArgs->m_pAnsi, pArgs->m_nLeftPos, pArgs->m_nRightPos, pArgs->m_pcItems, pArgs->m_nCount, pArgs->m_enType, pAsyncData);
+
+  pAsyncData->m_nResult = (size_t) bRet;
+  return bRet;
+}
+
+static mdz_bool mdz_ext_trim(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, enum mdz_ext_trim_type enType, struct mdz_asyncData* pAsyncData)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  struct mdz_ext_trimArgs* pArgs;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    mdz_ext_schedDiscard(pAsyncData);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, (MDZ_EXT_TRIM_LEFT == enType) ? MDZ_ANSI_STATS_TRIMLEFTFAST : ((MDZ_EXT_TRIM_RIGHT == enType) ? MDZ_ANSI_STATS_TRIMRIGHTFAST : MDZ_ANSI_STATS_TRIMFAST),
+                     pAnsi, nLeftPos, nRightPos, NULL);
+
+  if (NULL == pAsyncData)
+  {
+    bRet = mdz_ext_trimAnsi(pAnsi, nLeftPos, nRightPos, pcItems, nCount, enType, NULL);
+    mdz_ext_statsEnd(&oStatsCall, mdz_false);
+    return bRet;
+  }
+
+  pArgs = (struct mdz_ext_trimArgs*) malloc(sizeof(struct mdz_ext_trimArgs));
+  if (NULL != pArgs)
+  {
+    pArgs->m_pAnsi = pAnsi;
+    pArgs->m_nLeftPos = nLeftPos;
+    pArgs->m_nRightPos = nRightPos;
+    pArgs->m_pcItems = pcItems;
+    pArgs->m_nCount = nCount;
+    pArgs->m_enType = enType;
+  }
+
+  return mdz_ext_startAsync(pAnsi, pAsyncData, mdz_ext_trimAsync, pArgs, &oStatsCall);
+}
+
+/**
+ * \defgroup Interface functions
+ */
+
+mdz_bool mdz_ansi_trimLeftFast_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  return mdz_ext_trim(pAnsi, nLeftPos, nRightPos, pcItems, nCount, MDZ_EXT_TRIM_LEFT, pAsyncData);
+}
+
+mdz_bool mdz_ansi_trimRightFast_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  return mdz_ext_trim(pAnsi, nLeftPos, nRightPos, pcItems, nCount, MDZ_EXT_TRIM_RIGHT, pAsyncData);
+}
+
+mdz_bool mdz_ansi_trimFast_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData)
+{
+  return mdz_ext_trim(pAnsi, nLeftPos, nRightPos, pcItems, nCount, MDZ_EXT_TRIM_BOTH, pAsyncData);
+}
+
+mdz_bool mdz_ansi_trimBounds(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnOutLeftPos, size_t* pnOutRightPos)
+{
+  struct mdz_ext_statsCall oStatsCall;
+  size_t nFirst;
+  size_t nLast;
+  mdz_bool bCancelled;
+  mdz_bool bRet;
+
+  if (NULL == pAnsi)
+  {
+    return mdz_false;
+  }
+
+  if (NULL == pnOutLeftPos || NULL == pnOutRightPos)
+  {
+    mdz_ext_setError(pAnsi, MDZ_ERROR_DATA);
+    return mdz_false;
+  }
+
+  mdz_ext_statsBegin(&oStatsCall, MDZ_ANSI_STATS_TRIMBOUNDS, pAnsi, nLeftPos, nRightPos, NULL);
+
+  bRet = mdz_ext_trimFind(pAnsi, nLeftPos, nRightPos, pcItems, nCount, MDZ_EXT_TRIM_BOTH, &nFirst, &nLast, NULL, &bCancelled);
+  if (bRet)
+  {
+    *pnOutLeftPos = nFirst;
+    *pnOutRightPos = nLast;
+  }
+
+  mdz_ext_statsEnd(&oStatsCall, mdz_false);
+  return bRet;
+}
@@ -0,0 +1,1410 @@
+/**
+ * \ingroup mdz_ansi library
+ *
+ * \author maxdz Software GmbH
+ *
+ * \par license
+ * This file is subject to the terms and conditions defined in file 'LICENSE.txt', which is part of this source code package.
+ *
+ * \par description
+ * mdz_ansi_ext contains additional mdz_ansi functions, which are distributed in source form (see "ext" directory).
+ * Functions work on strings created with mdz_ansi library and use only its public interface, thus mdz_ansi library should be initialized with mdz_ansi_init() before any call.
+ *
+ * For usage, compile source files of "ext" directory together with your project (with directory of this file in include path) and link with mdz_ansi library.
+ * Under UNIX/Linux link also with pthreads.
+ *
+ * Large ranges are processed using SIMD instructions (SSE2/AVX2 with run-time detection on x86/x64) and are split between several threads.
+ * Build configuration macros are described in "ext/mdz_ansi_ext_internal.h".
+ *
+ * Asynchronous calls return immediately after start of execution thread. Result of call is placed in m_nResult of pAsyncData.
+ *
+ * Asynchronous calls check m_bCancel of pAsyncData at least every MDZ_ANSI_EXT_CANCEL_CHUNK bytes on every thread, thus cancellation latency doesn't depend on size of range.
+ * If call is cancelled, m_bFinished is mdz_false and m_nResult contains position to resume from (see pAsyncData of each function; cancelled trims make no changes):
+ * continuing the call from this position completes it.
+ *
+ * Call statistics (see "Statistics functions") are collected only if "ext" directory is compiled with MDZ_ANSI_EXT_STATS defined.
+ *
+ */
+
+#ifndef MDZ_ANSI_EXT_H
+#define MDZ_ANSI_EXT_H
+
+#include "mdz_ansi.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \defgroup Transform functions
+ */
+
+/**
+ * Convert ASCII characters 'A'..'Z' residing between nLeftPos and nRightPos into lower-case. "ANSI" characters (128 - 255) are not changed.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to convert from. Use 0 to convert from the beginning of string
+ * \param nRightPos - 0-based end position to convert up to. Use Size-1 or -1 to convert till the end of string
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position after converted items: items from nLeftPos till m_nResult are converted, the rest are not changed
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No conversion is made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "ABCdef#H" : (pAnsi, 0, 7) => "abcdef#h"
+ * "ABCdef#H" : (pAnsi, 1, 6) => "Abcdef#H"
+ */
+mdz_bool mdz_ansi_toLower_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_toLower(pAnsi, nLeftPos, nRightPos) mdz_ansi_toLower_async(pAnsi, nLeftPos, nRightPos, NULL)
+
+/**
+ * Convert ASCII characters 'a'..'z' residing between nLeftPos and nRightPos into upper-case. "ANSI" characters (128 - 255) are not changed.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to convert from. Use 0 to convert from the beginning of string
+ * \param nRightPos - 0-based end position to convert up to. Use Size-1 or -1 to convert till the end of string
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position after converted items: items from nLeftPos till m_nResult are converted, the rest are not changed
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No conversion is made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "abcDEF#h" : (pAnsi, 0, 7) => "ABCDEF#H"
+ */
+mdz_bool mdz_ansi_toUpper_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_toUpper(pAnsi, nLeftPos, nRightPos) mdz_ansi_toUpper_async(pAnsi, nLeftPos, nRightPos, NULL)
+
+/**
+ * Replace every item residing between nLeftPos and nRightPos with pcTable[(unsigned char) item] (like "tr" utility does).
+ * Items which are mapped on themselves are skipped using SIMD scan, thus sparse replacements are fast.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to translate from. Use 0 to translate from the beginning of string
+ * \param nRightPos - 0-based end position to translate up to. Use Size-1 or -1 to translate till the end of string
+ * \param pcTable - translation table of 256 items
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position after converted items: items from nLeftPos till m_nResult are converted, the rest are not changed
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pcTable == NULL (MDZ_ERROR_ITEMS), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No translation is made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "ab\tc\rd" : (pAnsi, 0, 5, <table mapping 0..31 into ' '>) => "ab c d"
+ */
+mdz_bool mdz_ansi_translate_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const unsigned char* pcTable, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_translate(pAnsi, nLeftPos, nRightPos, pcTable) mdz_ansi_translate_async(pAnsi, nLeftPos, nRightPos, pcTable, NULL)
+
+/**
+ * Remove all items contained in pcItems, residing between nLeftPos and nRightPos. Remaining items are compacted in one pass (using SIMD compression with AVX2). After remove(s) Capacity doesn't change, Size decreases on number of removed items.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to remove items from. Use 0 to remove from the beginning of string
+ * \param nRightPos - 0-based end position to remove items up to. Use Size-1 or -1 to remove till the end of string
+ * \param pcItems - pointer to items to remove
+ * \param nCount - number of items or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. Number of removed items is placed in m_nResult.
+ * If cancelled, m_nResult is position in changed string to resume from: items from nLeftPos till m_nResult are processed, the rest are not changed. Number of removed items is decrease of Size
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No removes are made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "a\r\nb\r\n" : (pAnsi, 0, 5, "\r", 1) => "a\nb\n"
+ * "a-b_c-d"    : (pAnsi, 2, 6, "-_", 2) => "a-bcd"
+ */
+mdz_bool mdz_ansi_removeAnyOf_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_removeAnyOf(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_removeAnyOf_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * Remove all non-overlapping occurrences of pcItems sub-string, residing between nLeftPos and nRightPos. Works like mdz_ansi_remove_async(), but remaining items are compacted in one pass:
+ * every kept item is moved at most once and the rest of string after nRightPos is moved once. After remove(s) Capacity doesn't change, Size decreases on number of removed items.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to remove sub-strings from. Use 0 to remove from the beginning of string
+ * \param nRightPos - 0-based end position to remove sub-strings up to. Use Size-1 or -1 to remove till the end of string
+ * \param pcItems - pointer to sub-string to remove
+ * \param nCount - size of sub-string or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. Number of removed sub-strings is placed in m_nResult.
+ * If cancelled, m_nResult is position in changed string to resume from: items from nLeftPos till m_nResult are processed, the rest are not changed
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT), or nCount is too big (MDZ_ERROR_BIGCOUNT). No removes are made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "a\r\nb\r\n" : (pAnsi, 0, 5, "\r\n", 2) => "ab"
+ * "aaaaa"      : (pAnsi, 0, 4, "aa", 2)   => "a"
+ */
+mdz_bool mdz_ansi_removeAll_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_removeAll(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_removeAll_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * Fills pSubAnsi with items from pAnsi residing between nLeftPos and nRightPos, converted into lower-case (see mdz_ansi_toLower_async()).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to get items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to get items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pSubAnsi - pointer to string where items should be copied. Previous content of pSubAnsi is cleared. Data in pSubAnsi will be re-reserved to appropriate size if necessary
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pSubAnsi contains result for items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pSubAnsi == NULL or pSubAnsi == pAnsi (MDZ_ERROR_SUBCONTAINER), or reservation of pSubAnsi failed (error code of pSubAnsi)
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No copying is made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_copyLower_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_copyLower(pAnsi, nLeftPos, nRightPos, pSubAnsi) mdz_ansi_copyLower_async(pAnsi, nLeftPos, nRightPos, pSubAnsi, NULL)
+
+/**
+ * Fills pSubAnsi with items from pAnsi residing between nLeftPos and nRightPos, converted into upper-case (see mdz_ansi_toUpper_async()).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to get items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to get items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pSubAnsi - pointer to string where items should be copied. Previous content of pSubAnsi is cleared. Data in pSubAnsi will be re-reserved to appropriate size if necessary
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pSubAnsi contains result for items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pSubAnsi == NULL or pSubAnsi == pAnsi (MDZ_ERROR_SUBCONTAINER), or reservation of pSubAnsi failed (error code of pSubAnsi)
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No copying is made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_copyUpper_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_copyUpper(pAnsi, nLeftPos, nRightPos, pSubAnsi) mdz_ansi_copyUpper_async(pAnsi, nLeftPos, nRightPos, pSubAnsi, NULL)
+
+/**
+ * Fills pSubAnsi with items from pAnsi residing between nLeftPos and nRightPos, translated using pcTable (see mdz_ansi_translate_async()).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to get items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to get items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pcTable - translation table of 256 items
+ * \param pSubAnsi - pointer to string where items should be copied. Previous content of pSubAnsi is cleared. Data in pSubAnsi will be re-reserved to appropriate size if necessary
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pSubAnsi contains result for items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pSubAnsi == NULL or pSubAnsi == pAnsi (MDZ_ERROR_SUBCONTAINER), or reservation of pSubAnsi failed (error code of pSubAnsi)
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pcTable == NULL (MDZ_ERROR_ITEMS), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No copying is made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_copyTranslated_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const unsigned char* pcTable, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_copyTranslated(pAnsi, nLeftPos, nRightPos, pcTable, pSubAnsi) mdz_ansi_copyTranslated_async(pAnsi, nLeftPos, nRightPos, pcTable, pSubAnsi, NULL)
+
+/**
+ * Fills pSubAnsi with items from pAnsi residing between nLeftPos and nRightPos, except items contained in pcItems (see mdz_ansi_removeAnyOf_async()).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to get items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to get items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pcItems - pointer to items to skip
+ * \param nCount - number of items or 0 if pcItems until 0-terminator should be used
+ * \param pSubAnsi - pointer to string where items should be copied. Previous content of pSubAnsi is cleared. Data in pSubAnsi will be re-reserved to appropriate size if necessary
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pSubAnsi contains result for items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pSubAnsi == NULL or pSubAnsi == pAnsi (MDZ_ERROR_SUBCONTAINER), or reservation of pSubAnsi failed (error code of pSubAnsi)
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No copying is made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_copyWithoutAnyOf_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_copyWithoutAnyOf(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pSubAnsi) mdz_ansi_copyWithoutAnyOf_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pSubAnsi, NULL)
+
+/**
+ * Classes of items, as defined for "C" locale. Classes can be combined with bitwise OR
+ */
+enum mdz_ansi_class
+{
+  /**
+   * 'a'..'z'
+   */
+  MDZ_ANSI_CLASS_LOWER = 0x01,
+
+  /**
+   * 'A'..'Z'
+   */
+  MDZ_ANSI_CLASS_UPPER = 0x02,
+
+  /**
+   * '0'..'9'
+   */
+  MDZ_ANSI_CLASS_DIGIT = 0x04,
+
+  /**
+   * ' ', '\t', '\n', '\v', '\f', '\r'
+   */
+  MDZ_ANSI_CLASS_SPACE = 0x08,
+
+  /**
+   * Printable items (33 - 126), which are not letters or digits
+   */
+  MDZ_ANSI_CLASS_PUNCT = 0x10,
+
+  /**
+   * Control items (0 - 31 and 127)
+   */
+  MDZ_ANSI_CLASS_CNTRL = 0x20,
+
+  /**
+   * "ANSI" items (128 - 255)
+   */
+  MDZ_ANSI_CLASS_HIGH = 0x40,
+
+  /**
+   * '0'..'9', 'a'..'f', 'A'..'F'
+   */
+  MDZ_ANSI_CLASS_XDIGIT = 0x80,
+
+  MDZ_ANSI_CLASS_ALPHA = MDZ_ANSI_CLASS_LOWER | MDZ_ANSI_CLASS_UPPER,
+  MDZ_ANSI_CLASS_ALNUM = MDZ_ANSI_CLASS_ALPHA | MDZ_ANSI_CLASS_DIGIT
+};
+
+/**
+ * Find first item which belongs (or does not belong if bMember == mdz_false) to one of nClasses. Returns 0-based position of item (if found), or string Size if not found, or SIZE_MAX if error.
+ * Items are compared with 16 (SSE2) or 32 (AVX2) positions at once, like in mdz_ansi_trimFast_async().
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to search from left. Use 0 to search from the beginning of string
+ * \param nRightPos - 0-based end position to search up to. Use Size-1 or -1 to search till the end of string
+ * \param nClasses - combination of mdz_ansi_class values
+ * \param bMember - mdz_true to find item belonging to nClasses, mdz_false to find item not belonging to nClasses
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. Position is placed in m_nResult.
+ * If cancelled, m_nResult is new nLeftPos to resume from: no item is found between nLeftPos and m_nResult
+ * \return:
+ * SIZE_MAX - if pAnsi == NULL, or thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * Size     - if nClasses contains no mdz_ansi_class values (MDZ_ERROR_ITEMS), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No search is made
+ * Size     - if item not found, or asynchronous call is started
+ * Result   - 0-based position of found item
+ * \examples:
+ * "key = 42;" : (pAnsi, 0, 8, MDZ_ANSI_CLASS_DIGIT, mdz_true)                         => 6
+ * "key = 42;" : (pAnsi, 3, 8, MDZ_ANSI_CLASS_SPACE | MDZ_ANSI_CLASS_PUNCT, mdz_false) => 6
+ */
+size_t mdz_ansi_findClass_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, unsigned int nClasses, mdz_bool bMember, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_findClass(pAnsi, nLeftPos, nRightPos, nClasses, bMember) mdz_ansi_findClass_async(pAnsi, nLeftPos, nRightPos, nClasses, bMember, NULL)
+
+/**
+ * Fill pcItems with all items belonging to one of nClasses, in increasing order. Result can be used as pcItems of functions taking set of items
+ * (mdz_ansi_removeAnyOf_async(), mdz_ansi_copyWithoutAnyOf_async(), mdz_ansi_trimFast_async(), mdz_ansi_countAnyOf_async() etc.), together with returned count.
+ * \param nClasses - combination of mdz_ansi_class values
+ * \param pcItems - pointer to buffer of at least 256 items. Buffer is not 0-terminated
+ * \return:
+ * 0        - if pcItems == NULL, or nClasses contains no mdz_ansi_class values
+ * Result   - number of items placed in pcItems
+ * \examples:
+ * (MDZ_ANSI_CLASS_SPACE, pcItems)  => 6, pcItems: "\t\n\v\f\r "
+ * (MDZ_ANSI_CLASS_XDIGIT, pcItems) => 22, pcItems: "0123456789ABCDEFabcdef"
+ */
+size_t mdz_ansi_classItems(unsigned int nClasses, char* pcItems);
+
+/**
+ * \defgroup Trim functions
+ */
+
+/**
+ * Remove items which are contained in pcItems from left, until first non-contained in pcItems item is reached. Works like mdz_ansi_trimLeft_async(), but non-contained item is searched using SIMD scan
+ * and trimmed items are removed with one move of remaining data. Suitable for ranges padded with large runs of spaces/0s.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to trim item(s) from left. Use 0 to trim from the beginning of string
+ * \param nRightPos - 0-based end position to trim item(s) up to. Use Size-1 or -1 to trim till the end of string
+ * \param pcItems - pointer to items to remove
+ * \param nCount - number of items to remove or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START), or asynchronous call is cancelled. No trims are made
+ * mdz_true  - if string is empty (MDZ_ERROR_EMPTY), or pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No trims are made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "   abc   " : (pAnsi, 0, 8, " ", 1) => "abc   "
+ */
+mdz_bool mdz_ansi_trimLeftFast_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_trimLeftFast(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_trimLeftFast_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * Remove items which are contained in pcItems from right, until first non-contained in pcItems item is reached. Works like mdz_ansi_trimRight_async(), but non-contained item is searched using SIMD scan
+ * and trimmed items are removed with one move of remaining data.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based end position to trim item(s) up to. Use 0 to trim till the beginning of string
+ * \param nRightPos - 0-based start position to trim item(s) from right. Use Size-1 or -1 to trim from the end of string
+ * \param pcItems - pointer to items to remove
+ * \param nCount - number of items to remove or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START), or asynchronous call is cancelled. No trims are made
+ * mdz_true  - if string is empty (MDZ_ERROR_EMPTY), or pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No trims are made
+ * mdz_true  - operation succeeded
+ * \examples:
+ * "   abc \0\0" : (pAnsi, 0, 8, " \0", 2) => "   abc"
+ */
+mdz_bool mdz_ansi_trimRightFast_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_trimRightFast(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_trimRightFast_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * Remove items which are contained in pcItems from left and from right, until first non-contained in pcItems item is reached. Works like mdz_ansi_trim_async(), but non-contained items are searched using SIMD scan.
+ * Right part is removed first, thus at most two moves of remaining data are made.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to trim item(s) from left. Use 0 to trim from the beginning of string
+ * \param nRightPos - 0-based start position to trim item(s) from right. Use Size-1 or -1 to trim from the end of string
+ * \param pcItems - pointer to items to remove
+ * \param nCount - number of items to remove or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START), or asynchronous call is cancelled. No trims are made
+ * mdz_true  - if string is empty (MDZ_ERROR_EMPTY), or pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No trims are made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_trimFast_async(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_trimFast(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_trimFast_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * "Logical" trim: find bounds of range between nLeftPos and nRightPos after trimming of items contained in pcItems from left and from right. String data is not moved or changed,
+ * returned positions may be used as nLeftPos/nRightPos in subsequent calls instead of physical trimming.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to trim item(s) from left. Use 0 to trim from the beginning of string
+ * \param nRightPos - 0-based start position to trim item(s) from right. Use Size-1 or -1 to trim from the end of string
+ * \param pcItems - pointer to items to trim
+ * \param nCount - number of items to trim or 0 if pcItems until 0-terminator should be used
+ * \param pnOutLeftPos - returned 0-based position of first non-trimmed item
+ * \param pnOutRightPos - returned 0-based position of last non-trimmed item
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pnOutLeftPos == NULL or pnOutRightPos == NULL (MDZ_ERROR_DATA), or string is empty (MDZ_ERROR_EMPTY), or pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT)
+ * mdz_true  - operation succeeded. If all items are trimmed, *pnOutLeftPos is nRightPos+1 and *pnOutRightPos is nRightPos
+ * \examples:
+ * "  abc  " : (pAnsi, 0, 6, " ", 1) => *pnOutLeftPos == 2, *pnOutRightPos == 4
+ * "       " : (pAnsi, 0, 6, " ", 1) => *pnOutLeftPos == 7, *pnOutRightPos == 6
+ */
+mdz_bool mdz_ansi_trimBounds(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnOutLeftPos, size_t* pnOutRightPos);
+
+/**
+ * \defgroup Search functions
+ */
+
+/**
+ * Find first occurrence of pcItems in string. Returns 0-based position of match (if found), or string Size if not found, or SIZE_MAX if error. Works like mdz_ansi_find_async(), but first and last items of pcItems
+ * are compared with 16 (SSE2) or 32 (AVX2) positions at once, only candidates are verified. Uses the same kernel as mdz_ansi_rfindFast_async(), thus forward and reverse searches have the same speed.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to search from left. Use 0 to search from the beginning of string
+ * \param nRightPos - 0-based end position to search up to. Use Size-1 or -1 to search till the end of string
+ * \param pcItems - pointer to items to find
+ * \param nCount - number of items to find or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. Position is placed in m_nResult.
+ * If cancelled, m_nResult is new nLeftPos to resume from: no match starts between nLeftPos and m_nResult
+ * \return:
+ * SIZE_MAX - if pAnsi == NULL, or thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * Size     - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT), or nCount is too big (MDZ_ERROR_BIGCOUNT). No search is made
+ * Size     - if item(s) not found, or asynchronous call is started
+ * Result   - 0-based position of first match
+ * \examples:
+ * "abcdefgh" : (pAnsi, 0, 7, "cd", 2) => 2
+ * "abcdefgh" : (pAnsi, 3, 7, "cd", 2) => 8
+ * "aaaa"     : (pAnsi, 0, 3, "aa", 2) => 0
+ */
+size_t mdz_ansi_findFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_findFast(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_findFast_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * Find last occurrence of pcItems in string. Returns 0-based position of match (if found), or string Size if not found, or SIZE_MAX if error. Works like mdz_ansi_rfind_async(), but uses the kernel of mdz_ansi_findFast_async()
+ * running from right to left.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based end position to find up to. Use 0 to search till the beginning of string
+ * \param nRightPos - 0-based start position to find from right. Use Size-1 or -1 to search from the end of string
+ * \param pcItems - pointer to items to find
+ * \param nCount - number of items to find or 0 if pcItems until 0-terminator should be used
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. Position is placed in m_nResult.
+ * If cancelled, m_nResult is new nRightPos to resume from: no match ends after m_nResult
+ * \return:
+ * SIZE_MAX - if pAnsi == NULL, or thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * Size     - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT), or nCount is too big (MDZ_ERROR_BIGCOUNT). No search is made
+ * Size     - if item(s) not found, or asynchronous call is started
+ * Result   - 0-based position of last match
+ * \examples:
+ * "abcdefgh" : (pAnsi, 0, 7, "cd", 2) => 2
+ * "abcdefgh" : (pAnsi, 0, 2, "cd", 2) => 8
+ * "aaaa"     : (pAnsi, 0, 3, "aa", 2) => 2
+ */
+size_t mdz_ansi_rfindFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_rfindFast(pAnsi, nLeftPos, nRightPos, pcItems, nCount) mdz_ansi_rfindFast_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, NULL)
+
+/**
+ * Find last cItem in string. Returns 0-based position of match (if found), or string Size if not found, or SIZE_MAX if error. Works like mdz_ansi_rfindSingle_async(), but 16 (SSE2) or 32 (AVX2) items
+ * are compared at once - reverse counterpart of memchr() used by mdz_ansi_findSingle_async().
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based end position to find up to. Use 0 to search till the beginning of string
+ * \param nRightPos - 0-based start position to find from right. Use Size-1 or -1 to search from the end of string
+ * \param cItem - item to find
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. Position is placed in m_nResult.
+ * If cancelled, m_nResult is new nRightPos to resume from: item is not found after m_nResult
+ * \return:
+ * SIZE_MAX - if pAnsi == NULL, or thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * Size     - if nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No search is made
+ * Size     - if item not found, or asynchronous call is started
+ * Result   - 0-based position of last match
+ * \examples:
+ * "abcdefgh" : (pAnsi, 0, 7, 'd') => 3
+ * "abcdefgh" : (pAnsi, 4, 7, 'd') => 8
+ * "aaaa"     : (pAnsi, 0, 3, 'a') => 3
+ */
+size_t mdz_ansi_rfindSingleFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, char cItem, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_rfindSingleFast(pAnsi, nLeftPos, nRightPos, cItem) mdz_ansi_rfindSingleFast_async(pAnsi, nLeftPos, nRightPos, cItem, NULL)
+
+/**
+ * \defgroup Unchecked functions
+ *
+ * Fast paths for tight loops on short strings. Parameters are not checked, m_enErrorCode is not changed, statistics are not collected and mdz_ansi library is not called,
+ * thus the call costs only the work on data. Range is processed in calling thread. Caller is responsible for: pAnsi != NULL, nLeftPos <= nRightPos < Size, pcItems != NULL and 0 < nCount <= nRightPos - nLeftPos + 1.
+ * Size-1 should be used as nRightPos (-1 is not resolved). Use checked functions if parameters are not known to be valid.
+ */
+
+/**
+ * Find first occurrence of pcItems in string. Works like mdz_ansi_findFast_async(), but without checks of parameters (see above).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to search from left
+ * \param nRightPos - 0-based end position to search up to
+ * \param pcItems - pointer to items to find
+ * \param nCount - number of items to find
+ * \return:
+ * nRightPos + 1 - if item(s) not found
+ * Result        - 0-based position of first match
+ * \examples:
+ * "abcdefgh" : (pAnsi, 0, 7, "cd", 2) => 2
+ * "abcdefgh" : (pAnsi, 3, 7, "cd", 2) => 8
+ * "abcdefgh" : (pAnsi, 0, 2, "cd", 2) => 3
+ */
+size_t mdz_ansi_findFastUnchecked(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount);
+
+/**
+ * Find last occurrence of pcItems in string. Works like mdz_ansi_rfindFast_async(), but without checks of parameters (see above).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based end position to find up to
+ * \param nRightPos - 0-based start position to find from right
+ * \param pcItems - pointer to items to find
+ * \param nCount - number of items to find
+ * \return:
+ * nRightPos + 1 - if item(s) not found
+ * Result        - 0-based position of last match
+ * \examples:
+ * "abcdefgh" : (pAnsi, 0, 7, "cd", 2) => 2
+ * "abcdefgh" : (pAnsi, 0, 2, "cd", 2) => 3
+ * "aaaa"     : (pAnsi, 0, 3, "aa", 2) => 2
+ */
+size_t mdz_ansi_rfindFastUnchecked(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount);
+
+/**
+ * Convert items between nLeftPos and nRightPos to lower case. Works like mdz_ansi_toLower_async(), but without checks of parameters (see above).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position of range
+ * \param nRightPos - 0-based end position of range
+ */
+void mdz_ansi_toLowerUnchecked(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos);
+
+/**
+ * Convert items between nLeftPos and nRightPos to upper case. Works like mdz_ansi_toUpper_async(), but without checks of parameters (see above).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position of range
+ * \param nRightPos - 0-based end position of range
+ */
+void mdz_ansi_toUpperUnchecked(struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos);
+
+/**
+ * \defgroup Layout functions
+ *
+ * mdz_ansi_size(), mdz_ansi_capacity(), mdz_ansi_offsetFromStart() and mdz_ansi_isAttachedData() are calls into mdz_ansi library, which compiler cannot inline or hoist out of loops.
+ * mdz_ansi_getLayout() reads them once into mdz_ansi_layout, whose members can be used in loops without calls. Use together with unchecked functions for tight loops.
+ */
+
+/**
+ * Fields of string, read by mdz_ansi_getLayout(). Layout is valid until next change of string (insert, remove, reserve, etc.)
+ */
+struct mdz_ansi_layout
+{
+  /**
+   * Pointer to data of string (m_pData of string)
+   */
+  char* m_pData;
+
+  /**
+   * Size of string in items
+   */
+  size_t m_nSize;
+
+  /**
+   * Capacity of string in items
+   */
+  size_t m_nCapacity;
+
+  /**
+   * OffsetFromStart of string in items
+   */
+  size_t m_nOffsetFromStart;
+
+  /**
+   * mdz_true if string data is attached
+   */
+  mdz_bool m_bAttachedData;
+};
+
+/**
+ * Read Size, Capacity, OffsetFromStart and attached state of string into pLayout.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param pLayout - pointer to layout to fill
+ * \return:
+ * mdz_false - if pAnsi == NULL or pLayout == NULL
+ * mdz_true  - if succeeded
+ * \examples:
+ * struct mdz_ansi_layout oLayout;
+ * mdz_ansi_getLayout(pAnsi, &oLayout);
+ * for (i = 0; i + 16 <= oLayout.m_nSize; i += 16) nFound += (mdz_ansi_findFastUnchecked(pAnsi, i, i + 15, "ab", 2) <= i + 15);
+ */
+mdz_bool mdz_ansi_getLayout(const struct mdz_Ansi* pAnsi, struct mdz_ansi_layout* pLayout);
+
+/**
+ * \defgroup Bulk functions
+ *
+ * Initialization and copying of huge ranges. Ranges from MDZ_ANSI_EXT_PARALLEL_THRESHOLD bytes are split between threads, from MDZ_ANSI_EXT_STREAM_THRESHOLD bytes
+ * non-temporal (streaming) stores are used: written data bypasses cache, thus cached data of other code is not evicted. Non-temporal stores are used only if data is not reallocated by call:
+ * new pages are zeroed by OS through cache, and non-temporal stores into them are slower than usual stores. Thus reserve Capacity in advance (or use mdz_ansi_createHuge() with bFirstTouch)
+ * if the same string is initialized or filled repeatedly.
+ */
+
+/**
+ * Reserve nNewCapacity items for string and initialize all items in cItem. Works like mdz_ansi_reserveAndInit_async(), but initialization is split between threads and uses
+ * non-temporal stores (see above). May be called only on empty string (with Size == 0). After call, string Size equals to Capacity-1.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create(), mdz_ansi_create_attached() or mdz_ansi_createHuge()
+ * \param nNewCapacity - capacity to reserve in items
+ * \param cItem - item for string initialization
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is number of initialized items: string Size equals to it
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if memory allocation failed (MDZ_ERROR_ALLOCATION)
+ * mdz_false - if Size > 0 (MDZ_ERROR_NONEMPTY)
+ * mdz_false - if nNewCapacity > Capacity and m_pData is attached using mdz_ansi_attachData() (MDZ_ERROR_ATTACHED)
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if nNewCapacity <= Capacity (MDZ_ERROR_CAPACITY), initialization succeeded
+ * mdz_true  - reservation and initialization succeeded
+ */
+mdz_bool mdz_ansi_reserveAndInitFast_async(struct mdz_Ansi* pAnsi, size_t nNewCapacity, char cItem, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_reserveAndInitFast(pAnsi, nNewCapacity, cItem) mdz_ansi_reserveAndInitFast_async(pAnsi, nNewCapacity, cItem, NULL)
+
+/**
+ * Fills pSubAnsi with items from pAnsi residing between nLeftPos and nRightPos. Works like mdz_ansi_copySubAnsiFrom_async(), but copying is split between threads and uses non-temporal stores (see above).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to get items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to get items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pSubAnsi - pointer to string where items should be copied. Previous content of pSubAnsi is cleared. Data in pSubAnsi will be re-reserved to appropriate size if necessary
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pSubAnsi contains items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pSubAnsi == NULL or pSubAnsi == pAnsi (MDZ_ERROR_SUBCONTAINER), or reservation of pSubAnsi failed (error code of pSubAnsi)
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No copying is made
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE in pSubAnsi). Error code of pAnsi is not changed
+ */
+mdz_bool mdz_ansi_copyFast_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_copyFast(pAnsi, nLeftPos, nRightPos, pSubAnsi) mdz_ansi_copyFast_async(pAnsi, nLeftPos, nRightPos, pSubAnsi, NULL)
+
+/**
+ * Create empty string with data of at least nCapacity items, allocated directly from OS and attached to string (see mdz_ansi_attachData()). Capacity is rounded up to page granularity.
+ * Capacity of string cannot grow: calls, which need more Capacity, fail with MDZ_ERROR_ATTACHED. String must be destroyed with mdz_ansi_destroyHuge() and must not be re-attached.
+ * \param nCapacity - capacity of string in items (including terminating 0)
+ * \param bHugePages - mdz_true if data should be placed on huge pages: under Linux data is aligned on 2 MB and advised for transparent huge pages, under Windows large pages are used
+ * if process has SeLockMemoryPrivilege (usual pages otherwise)
+ * \param bFirstTouch - mdz_true if pages should be touched before return by threads, between which huge ranges are split. Under first-touch NUMA policy pages are placed on nodes of these threads,
+ * and page faults are not taken later. mdz_false if pages should be touched on first use
+ * \return:
+ * NULL   - if nCapacity == 0, or allocation failed
+ * Result - pointer to string for use in other mdz_ansi functions
+ */
+struct mdz_Ansi* mdz_ansi_createHuge(size_t nCapacity, mdz_bool bHugePages, mdz_bool bFirstTouch);
+
+/**
+ * Destroy string created with mdz_ansi_createHuge() and release its data. *ppAnsi is set to NULL.
+ * \param ppAnsi - pointer to pointer to string returned by mdz_ansi_createHuge(). If ppAnsi or *ppAnsi is NULL, nothing is destroyed
+ */
+void mdz_ansi_destroyHuge(struct mdz_Ansi** ppAnsi);
+
+/**
+ * \defgroup Snapshot functions
+ *
+ * Copy-on-write snapshots for strings read by many threads and updated occasionally. Shared string publishes immutable versions of string. Reader acquires snapshot of current
+ * version without locks and without waiting, and may use it (with any non-modifying function) until release, while writers publish new versions. Writer modifies private copy of
+ * current version (see mdz_ansi_sharedBeginUpdate()) or publishes newly built string (see mdz_ansi_sharedPublish()). Writers are serialized and wait until readers, which are
+ * acquiring snapshot at the moment of publication, finish acquisition. Version is destroyed after its last snapshot is released.
+ *
+ * Non-modifying functions still set m_enErrorCode of string, and all snapshots of version share its string, thus readers overwrite error code of each other. m_enErrorCode of
+ * snapshot string is not meaningful: use return values of functions. Writers do not change published versions: mdz_ansi_sharedBeginUpdate() reports errors of copying on the copy.
+ */
+
+/**
+ * Shared string. Is created with mdz_ansi_sharedCreate() and destroyed with mdz_ansi_sharedDestroy()
+ */
+struct mdz_ansi_shared;
+
+/**
+ * Snapshot of version of shared string. Is acquired with mdz_ansi_snapshotAcquire() and released with mdz_ansi_snapshotRelease()
+ */
+struct mdz_ansi_snapshot;
+
+/**
+ * Create shared string with pAnsi as its first version. Shared string takes ownership of pAnsi: it must not be used or destroyed by client after successful call.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create()
+ * \return:
+ * NULL   - if pAnsi == NULL, or memory allocation failed (pAnsi is not taken)
+ * Result - pointer to shared string for use in other mdz_ansi_shared and mdz_ansi_snapshot functions
+ */
+struct mdz_ansi_shared* mdz_ansi_sharedCreate(struct mdz_Ansi* pAnsi);
+
+/**
+ * Destroy shared string and set *ppShared to NULL. Must not be called concurrently with other functions on the same shared string. Must not be called while update is pending:
+ * finish it with mdz_ansi_sharedEndUpdate() first. Snapshots, which are not released yet, stay valid: their versions are destroyed after release.
+ * \param ppShared - pointer to pointer to shared string returned by mdz_ansi_sharedCreate()
+ * \return:
+ * mdz_false - if ppShared == NULL, or *ppShared == NULL
+ * mdz_false - if update started with mdz_ansi_sharedBeginUpdate() is not finished. Nothing is destroyed
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_sharedDestroy(struct mdz_ansi_shared** ppShared);
+
+/**
+ * Acquire snapshot of current version of shared string. Never blocks: costs 3 atomic increments/decrements. Snapshot should be released with mdz_ansi_snapshotRelease().
+ * \param pShared - pointer to shared string returned by mdz_ansi_sharedCreate()
+ * \return:
+ * NULL   - if pShared == NULL
+ * Result - pointer to snapshot
+ */
+struct mdz_ansi_snapshot* mdz_ansi_snapshotAcquire(struct mdz_ansi_shared* pShared);
+
+/**
+ * Return string of snapshot. String must not be modified, and must not be used after snapshot is released. String is shared with other snapshots of the same version,
+ * thus its m_enErrorCode is not meaningful (see above).
+ * \param pSnapshot - pointer to snapshot returned by mdz_ansi_snapshotAcquire()
+ * \return:
+ * NULL   - if pSnapshot == NULL
+ * Result - pointer to string for use in non-modifying mdz_ansi functions
+ */
+const struct mdz_Ansi* mdz_ansi_snapshotAnsi(const struct mdz_ansi_snapshot* pSnapshot);
+
+/**
+ * Return version number of snapshot. First version of shared string is 0, every publication increments it. Can be used for check if data derived from snapshot is stale.
+ * \param pSnapshot - pointer to snapshot returned by mdz_ansi_snapshotAcquire()
+ * \return:
+ * SIZE_MAX - if pSnapshot == NULL
+ * Result   - version number
+ */
+size_t mdz_ansi_snapshotVersion(const struct mdz_ansi_snapshot* pSnapshot);
+
+/**
+ * Release snapshot and set *ppSnapshot to NULL. Version is destroyed if it is not current version of shared string anymore, and this is its last snapshot.
+ * \param ppSnapshot - pointer to pointer to snapshot returned by mdz_ansi_snapshotAcquire(). If ppSnapshot or *ppSnapshot is NULL, nothing is released
+ */
+void mdz_ansi_snapshotRelease(struct mdz_ansi_snapshot** ppSnapshot);
+
+/**
+ * Begin update of shared string: waits for other writers and returns private copy of current version (copied with mdz_ansi_copyFast(), which does not change current version). Copy may be modified with any mdz_ansi functions,
+ * readers do not see changes until mdz_ansi_sharedEndUpdate() is called. Other writers wait until mdz_ansi_sharedEndUpdate(), thus the same thread must not call mdz_ansi_sharedBeginUpdate()
+ * or mdz_ansi_sharedPublish() before it.
+ * \param pShared - pointer to shared string returned by mdz_ansi_sharedCreate()
+ * \return:
+ * NULL   - if pShared == NULL, or memory allocation failed. Update is not begun
+ * Result - pointer to copy. Is owned by shared string: must not be destroyed by client
+ */
+struct mdz_Ansi* mdz_ansi_sharedBeginUpdate(struct mdz_ansi_shared* pShared);
+
+/**
+ * Finish update begun with mdz_ansi_sharedBeginUpdate(). If bPublish is mdz_true, copy is published as new current version: snapshots acquired after return see it.
+ * Otherwise copy is destroyed. Copy must not be used after call.
+ * \param pShared - pointer to shared string returned by mdz_ansi_sharedCreate()
+ * \param bPublish - mdz_true if copy should be published, mdz_false if update should be discarded
+ * \return:
+ * mdz_false - if pShared == NULL, or update is not begun
+ * mdz_true  - if succeeded
+ */
+mdz_bool mdz_ansi_sharedEndUpdate(struct mdz_ansi_shared* pShared, mdz_bool bPublish);
+
+/**
+ * Publish pAnsi as new current version of shared string, without copying. Shared string takes ownership of pAnsi: it must not be used or destroyed by client after successful call.
+ * Waits for other writers.
+ * \param pShared - pointer to shared string returned by mdz_ansi_sharedCreate()
+ * \param pAnsi - pointer to string returned by mdz_ansi_create()
+ * \return:
+ * mdz_false - if pShared == NULL or pAnsi == NULL, or memory allocation failed (pAnsi is not taken)
+ * mdz_true  - if succeeded
+ */
+mdz_bool mdz_ansi_sharedPublish(struct mdz_ansi_shared* pShared, struct mdz_Ansi* pAnsi);
+
+/**
+ * \defgroup Compressed string functions
+ *
+ * Compressed read-only copy of string for rarely searched data (e.g. archived logs). String is split into blocks, which are compressed independently (LZ4-like compression, typical ratio
+ * on text is 2-5) and carry filters of contained bytes and byte pairs. Search decompresses only blocks, which may contain searched items according to their filters.
+ * Compressed string is not modified after creation, thus its functions may be called from several threads concurrently.
+ */
+
+/**
+ * Compressed string. Is created with mdz_ansi_compressedCreate() and destroyed with mdz_ansi_compressedDestroy()
+ */
+struct mdz_ansi_compressed;
+
+/**
+ * Create compressed copy of pAnsi. pAnsi is not modified and may be destroyed after call. Compression of large strings is split between threads.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nBlockSize - size of block in bytes (at least 1024). Use 0 for default size 64 KB. Smaller blocks are skipped by search more precisely, but are compressed worse
+ * \return:
+ * NULL   - if pAnsi == NULL or Size of pAnsi == 0, or nBlockSize is invalid, or memory allocation failed
+ * Result - pointer to compressed string for use in other mdz_ansi_compressed functions
+ */
+struct mdz_ansi_compressed* mdz_ansi_compressedCreate(const struct mdz_Ansi* pAnsi, size_t nBlockSize);
+
+/**
+ * Destroy compressed string and set *ppCompressed to NULL.
+ * \param ppCompressed - pointer to pointer to compressed string returned by mdz_ansi_compressedCreate(). If ppCompressed or *ppCompressed is NULL, nothing is destroyed
+ */
+void mdz_ansi_compressedDestroy(struct mdz_ansi_compressed** ppCompressed);
+
+/**
+ * Return Size of string, from which compressed string was created.
+ * \param pCompressed - pointer to compressed string returned by mdz_ansi_compressedCreate()
+ * \return:
+ * 0      - if pCompressed == NULL
+ * Result - Size of uncompressed string
+ */
+size_t mdz_ansi_compressedSize(const struct mdz_ansi_compressed* pCompressed);
+
+/**
+ * Return memory used by compressed string in bytes: compressed data, filters of blocks and internal structures.
+ * \param pCompressed - pointer to compressed string returned by mdz_ansi_compressedCreate()
+ * \return:
+ * 0      - if pCompressed == NULL
+ * Result - used memory in bytes
+ */
+size_t mdz_ansi_compressedMemory(const struct mdz_ansi_compressed* pCompressed);
+
+/**
+ * Fills pSubAnsi with decompressed items residing between nLeftPos and nRightPos. Decompression of large ranges is split between threads.
+ * \param pCompressed - pointer to compressed string returned by mdz_ansi_compressedCreate()
+ * \param nLeftPos - 0-based start position to get items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to get items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pSubAnsi - pointer to string where items should be copied. Previous content of pSubAnsi is cleared. Data in pSubAnsi will be re-reserved to appropriate size if necessary
+ * \return:
+ * mdz_false - if pCompressed == NULL or pSubAnsi == NULL
+ * mdz_false - if nLeftPos > nRightPos, or nRightPos >= Size. No copying is made
+ * mdz_false - if reservation of pSubAnsi failed (error code of pSubAnsi), or memory allocation failed
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_compressedCopy(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, struct mdz_Ansi* pSubAnsi);
+
+/**
+ * Find first occurrence of pcItems between nLeftPos and nRightPos. Works like mdz_ansi_findFast(), but decompresses only blocks, which may contain pcItems.
+ * Occurrences crossing borders of blocks are found without decompression if nCount <= 33.
+ * \param pCompressed - pointer to compressed string returned by mdz_ansi_compressedCreate()
+ * \param nLeftPos - 0-based start position to search from. Use 0 to search from the beginning of string
+ * \param nRightPos - 0-based end position to search up to. Use Size-1 or -1 to search till the end of string
+ * \param pcItems - items to find
+ * \param nCount - number of items to find or 0 if pcItems until 0-terminator should be used
+ * \return:
+ * SIZE_MAX - if pCompressed == NULL, or memory allocation failed
+ * Size     - if pcItems == NULL, or nCount == 0 and pcItems[0] == 0, or nLeftPos > nRightPos, or nRightPos >= Size, or nCount is too big. No search is made
+ * Size     - if pcItems not found
+ * Result   - 0-based position of first match
+ */
+size_t mdz_ansi_compressedFind(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount);
+
+/**
+ * Count number of pcItems occurrences between nLeftPos and nRightPos. Works like mdz_ansi_count(), but decompresses only blocks, which may contain pcItems.
+ * \param pCompressed - pointer to compressed string returned by mdz_ansi_compressedCreate()
+ * \param nLeftPos - 0-based start position to count from. Use 0 to count from the beginning of string
+ * \param nRightPos - 0-based end position to count up to. Use Size-1 or -1 to count till the end of string
+ * \param pcItems - items to count
+ * \param nCount - number of items to count or 0 if pcItems until 0-terminator should be used
+ * \param bAllowOverlapped - mdz_true if overlapped occurrences should be counted, otherwise mdz_false
+ * \return:
+ * SIZE_MAX - if pCompressed == NULL, or memory allocation failed
+ * 0        - if pcItems == NULL, or nCount == 0 and pcItems[0] == 0, or nLeftPos > nRightPos, or nRightPos >= Size, or nCount is too big. No counting is made
+ * Result   - count of occurrences. 0 if not found
+ */
+size_t mdz_ansi_compressedCount(const struct mdz_ansi_compressed* pCompressed, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, mdz_bool bAllowOverlapped);
+
+/**
+ * \defgroup Transcoding functions
+ *
+ * Conversions between Latin-1/Windows-1252 strings and UTF-8 or UTF-16 (both endiannesses). Size of output is computed exactly before conversion, thus output is reserved only once.
+ * Runs of ASCII characters are copied without decoding. Characters, which cannot be represented in target code page, and invalid sequences are replaced with given item.
+ */
+
+/**
+ * Single-byte code page of mdz_Ansi string
+ */
+enum mdz_ansi_codepage
+{
+  /**
+   * ISO 8859-1. Bytes map to code points 0-255
+   */
+  MDZ_ANSI_CODEPAGE_LATIN1 = 0,
+
+  /**
+   * Windows-1252. Like Latin-1, but bytes 0x80-0x9F map to typographic characters (euro sign, quotation marks, dashes etc.)
+   */
+  MDZ_ANSI_CODEPAGE_WINDOWS1252
+};
+
+/**
+ * Fills pUtf8 with UTF-8 encoding of items residing between nLeftPos and nRightPos.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to convert items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to convert items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param enCodepage - code page of pAnsi
+ * \param pUtf8 - pointer to string where UTF-8 bytes should be placed. Previous content of pUtf8 is cleared. Data in pUtf8 is reserved once to exact size of UTF-8 encoding
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pUtf8 == NULL or pUtf8 == pAnsi (MDZ_ERROR_SUBCONTAINER), or reservation of pUtf8 failed (error code of pUtf8)
+ * mdz_true  - if enCodepage is invalid (MDZ_ERROR_DATA), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No conversion is made, pUtf8 is not changed
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_toUtf8(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ansi_codepage enCodepage, struct mdz_Ansi* pUtf8);
+
+/**
+ * Converts items residing between nLeftPos and nRightPos into UTF-16 units of given endianness. Every item is one unit, thus nRightPos - nLeftPos + 1 units are needed.
+ * Under Windows this function may be used for wchar_t strings (use MDZ_ENDIAN_LITTLE).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to convert items from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to convert items up to. Use Size-1 or -1 to proceed till the end of string
+ * \param enCodepage - code page of pAnsi
+ * \param enEndianness - endianness of units in pnUtf16: MDZ_ENDIAN_LITTLE or MDZ_ENDIAN_BIG
+ * \param pnUtf16 - pointer to buffer for units. Use NULL to get only the number of units. Buffer is not 0-terminated
+ * \param nCapacity - capacity of pnUtf16 in units
+ * \return:
+ * SIZE_MAX - if pAnsi == NULL
+ * 0        - if enCodepage is invalid (MDZ_ERROR_DATA), or enEndianness is invalid (MDZ_ERROR_ENDIANNESS), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No conversion is made
+ * Result   - number of needed units. If pnUtf16 == NULL or nCapacity < Result, nothing is written (MDZ_ERROR_CAPACITY), otherwise units are written (MDZ_ERROR_NONE)
+ */
+size_t mdz_ansi_toUtf16(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, enum mdz_ansi_codepage enCodepage, enum mdz_endianness enEndianness, uint16_t* pnUtf16, size_t nCapacity);
+
+/**
+ * Replaces content of pAnsi with UTF-8 bytes pcUtf8 converted to enCodepage.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param pcUtf8 - UTF-8 bytes to convert. Need not be 0-terminated
+ * \param nSize - number of bytes in pcUtf8
+ * \param enCodepage - code page of pAnsi
+ * \param cReplacement - item, which replaces invalid sequences (every byte of them) and characters, which cannot be represented in enCodepage
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pcUtf8 == NULL (MDZ_ERROR_ITEMS), or enCodepage is invalid (MDZ_ERROR_DATA)
+ * mdz_false - if reservation of pAnsi failed (error code of pAnsi)
+ * mdz_true  - if some characters were replaced with cReplacement (MDZ_ERROR_CONTENT)
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_fromUtf8(struct mdz_Ansi* pAnsi, const unsigned char* pcUtf8, size_t nSize, enum mdz_ansi_codepage enCodepage, char cReplacement);
+
+/**
+ * Replaces content of pAnsi with UTF-16 units pnUtf16 converted to enCodepage. Under Windows this function may be used for wchar_t strings (use MDZ_ENDIAN_LITTLE).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param pnUtf16 - UTF-16 units to convert. Need not be 0-terminated
+ * \param nCount - number of units in pnUtf16
+ * \param enEndianness - endianness of units in pnUtf16: MDZ_ENDIAN_LITTLE or MDZ_ENDIAN_BIG
+ * \param enCodepage - code page of pAnsi
+ * \param cReplacement - item, which replaces unpaired surrogates and characters, which cannot be represented in enCodepage. Surrogate pair is replaced with one item
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pnUtf16 == NULL (MDZ_ERROR_ITEMS), or enEndianness is invalid (MDZ_ERROR_ENDIANNESS), or enCodepage is invalid (MDZ_ERROR_DATA)
+ * mdz_false - if reservation of pAnsi failed (error code of pAnsi)
+ * mdz_true  - if some characters were replaced with cReplacement (MDZ_ERROR_CONTENT)
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_fromUtf16(struct mdz_Ansi* pAnsi, const uint16_t* pnUtf16, size_t nCount, enum mdz_endianness enEndianness, enum mdz_ansi_codepage enCodepage, char cReplacement);
+
+/**
+ * \defgroup Number functions
+ *
+ * Parsing of numbers directly from ranges of string (without copying of substrings) and appending of decimal representation of numbers into string capacity (without sprintf()).
+ * Parse functions do not skip whitespace and are not affected by locale. Runs of digits are parsed 16 or 8 at a time.
+ */
+
+/**
+ * Parse decimal integer at nLeftPos: optional sign ('+' or '-') and digits.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based position of number
+ * \param nRightPos - 0-based end position to parse up to. Use Size-1 or -1 to parse till the end of string
+ * \param pnValue - pointer to parsed value
+ * \param pnEndPos - pointer to position after the last parsed item. If pnEndPos == NULL, the whole range must be a number
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pnValue == NULL (MDZ_ERROR_DATA), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT)
+ * mdz_false - if there is no number at nLeftPos: *pnValue = 0, *pnEndPos = nLeftPos (MDZ_ERROR_CONTENT)
+ * mdz_false - if value does not fit into int64_t: *pnValue = INT64_MIN or INT64_MAX, *pnEndPos is after digits (MDZ_ERROR_CONTENT)
+ * mdz_false - if pnEndPos == NULL and number is followed by other items in range (MDZ_ERROR_CONTENT)
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_parseInt64(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, int64_t* pnValue, size_t* pnEndPos);
+
+/**
+ * Parse decimal unsigned integer at nLeftPos: optional '+' and digits. Works like mdz_ansi_parseInt64(), if value does not fit into uint64_t, *pnValue = UINT64_MAX.
+ */
+mdz_bool mdz_ansi_parseUint64(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, uint64_t* pnValue, size_t* pnEndPos);
+
+/**
+ * Parse decimal floating-point number at nLeftPos: optional sign, digits with optional '.' and optional exponent ('e' or 'E', optional sign and digits), or "inf", "infinity", "nan" (ignoring case).
+ * Result is correctly rounded. Values out of range of double give infinity or 0. Numbers with more than 19 significant digits may be parsed with strtod() (affected by locale).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based position of number
+ * \param nRightPos - 0-based end position to parse up to. Use Size-1 or -1 to parse till the end of string
+ * \param pdValue - pointer to parsed value
+ * \param pnEndPos - pointer to position after the last parsed item. If pnEndPos == NULL, the whole range must be a number
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if pdValue == NULL (MDZ_ERROR_DATA), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT)
+ * mdz_false - if there is no number at nLeftPos: *pdValue = 0, *pnEndPos = nLeftPos (MDZ_ERROR_CONTENT)
+ * mdz_false - if pnEndPos == NULL and number is followed by other items in range (MDZ_ERROR_CONTENT)
+ * mdz_false - if memory allocation failed (MDZ_ERROR_ALLOCATION)
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_parseDouble(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, double* pdValue, size_t* pnEndPos);
+
+/**
+ * Append decimal representation of nValue to the end of string. Digits are written directly into string data. Capacity is at least doubled if it is not enough, thus series of appends is fast.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nValue - value to append
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if reservation failed (error code of pAnsi)
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_appendInt64(struct mdz_Ansi* pAnsi, int64_t nValue);
+
+/**
+ * Append decimal representation of nValue to the end of string. Works like mdz_ansi_appendInt64().
+ */
+mdz_bool mdz_ansi_appendUint64(struct mdz_Ansi* pAnsi, uint64_t nValue);
+
+/**
+ * Append shortest (in almost all cases) decimal representation of dValue, which is parsed back to the same double, to the end of string. Works like mdz_ansi_appendInt64().
+ * Fixed notation is used if decimal exponent is in range [-4, 17), otherwise exponential notation (e.g. "1.5e+20"). Special values are appended as "inf", "-inf", "nan".
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param dValue - value to append
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if reservation failed (error code of pAnsi)
+ * mdz_true  - operation succeeded (MDZ_ERROR_NONE)
+ */
+mdz_bool mdz_ansi_appendDouble(struct mdz_Ansi* pAnsi, double dValue);
+
+/**
+ * \defgroup Histogram functions
+ *
+ * Counting of bytes in one pass over range. Counters of all 256 bytes are split into interleaved sub-histograms, thus runs of equal bytes do not stall on increments of the same counter.
+ * Small sets of bytes are counted with SIMD comparisons. Ranges from MDZ_ANSI_EXT_PARALLEL_THRESHOLD bytes are split between threads.
+ */
+
+/**
+ * Count occurrences of every byte value in range.
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to count from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to count up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pnCounts - pointer to array of 256 counts: pnCounts[i] is number of items with value (unsigned char) i. Array is zeroed before counting
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pnCounts contains counts of items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pnCounts == NULL (MDZ_ERROR_DATA), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No counting is made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_histogram_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, size_t* pnCounts, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_histogram(pAnsi, nLeftPos, nRightPos, pnCounts) mdz_ansi_histogram_async(pAnsi, nLeftPos, nRightPos, pnCounts, NULL)
+
+/**
+ * Count occurrences of every item of pcItems in range. Up to 8 different items are counted with SIMD comparisons, more items are counted with histogram (see mdz_ansi_histogram_async()).
+ * \param pAnsi - pointer to string returned by mdz_ansi_create() or mdz_ansi_create_attached()
+ * \param nLeftPos - 0-based start position to count from. Use 0 to start from the beginning of string
+ * \param nRightPos - 0-based end position to count up to. Use Size-1 or -1 to proceed till the end of string
+ * \param pcItems - items to count. Repeated items get the same counts
+ * \param nCount - number of items to count. If 0, pcItems is zero-terminated
+ * \param pnCounts - pointer to array of nCount counts: pnCounts[i] is number of pcItems[i] in range. Array is zeroed before counting
+ * \param pAsyncData - pointer to shared async data for asynchronous call, or NULL if call should be synchronous. If cancelled, m_nResult is position to resume from: pnCounts contains counts of items from nLeftPos till m_nResult
+ * \return:
+ * mdz_false - if pAnsi == NULL
+ * mdz_false - if thread for asynchronous call cannot be started (MDZ_ERROR_THREAD_ALLOC, MDZ_ERROR_THREAD_START)
+ * mdz_true  - if pcItems == NULL (MDZ_ERROR_ITEMS), or nCount == 0 and pcItems[0] == 0 (MDZ_ERROR_ZEROCOUNT), or pnCounts == NULL (MDZ_ERROR_DATA), or nLeftPos > nRightPos (MDZ_ERROR_BIGLEFT), or nRightPos >= Size (MDZ_ERROR_BIGRIGHT). No counting is made
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_countAnyOf_async(const struct mdz_Ansi* pAnsi, size_t nLeftPos, size_t nRightPos, const char* pcItems, size_t nCount, size_t* pnCounts, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Synchronous version
+ */
+#define mdz_ansi_countAnyOf(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pnCounts) mdz_ansi_countAnyOf_async(pAnsi, nLeftPos, nRightPos, pcItems, nCount, pnCounts, NULL)
+
+/**
+ * \defgroup Completion queue functions
+ *
+ * Completion queue collects finished asynchronous calls of mdz_ansi_ext, thus client needs neither polling of m_bFinished nor joining of m_hThread.
+ * pAsyncData is added to queue before the asynchronous call is made with it. After the call is finished, pAsyncData is harvested from queue with mdz_ansi_queueHarvest().
+ * Harvested calls are joined (their m_hThread is waited for and released by queue). Asynchronous calls of mdz_ansi library itself are not posted into queues.
+ */
+
+/**
+ * Completion queue. Is created with mdz_ansi_queueCreate() and destroyed with mdz_ansi_queueDestroy()
+ */
+struct mdz_ansi_queue;
+
+/**
+ * Create empty completion queue.
+ * \return:
+ * NULL   - if memory allocation failed or notification handle cannot be created
+ * Result - pointer to queue for use in other mdz_ansi_queue functions
+ */
+struct mdz_ansi_queue* mdz_ansi_queueCreate(void);
+
+/**
+ * Destroy completion queue and set *ppQueue to NULL. Completed but not harvested calls are joined. Calls, which are not finished yet, are removed from queue:
+ * they are not posted anymore and should be joined by client.
+ * \param ppQueue - pointer to pointer to queue returned by mdz_ansi_queueCreate(). If ppQueue or *ppQueue is NULL, nothing is destroyed
+ */
+void mdz_ansi_queueDestroy(struct mdz_ansi_queue** ppQueue);
+
+/**
+ * Add pAsyncData to queue. Must be called before asynchronous call with pAsyncData is made. pAsyncData is posted into queue exactly once: after the call is finished,
+ * or immediately if thread of call cannot be started (function returns error, m_bFinished is mdz_false). If function fails before use of pAsyncData (e.g. pAnsi == NULL), pAsyncData remains in queue
+ * until mdz_ansi_queueDestroy(), thus return value of function should be checked.
+ * \param pQueue - pointer to queue returned by mdz_ansi_queueCreate()
+ * \param pAsyncData - pointer to async data of call. Must stay valid until it is harvested
+ * \return:
+ * mdz_false - if pQueue == NULL or pAsyncData == NULL, or memory allocation failed
+ * mdz_true  - if succeeded
+ */
+mdz_bool mdz_ansi_queueAdd(struct mdz_ansi_queue* pQueue, struct mdz_asyncData* pAsyncData);
+
+/**
+ * Harvest up to nMaxCount finished calls of queue into ppCompleted, in order of finishing. If no call is finished, waits up to nTimeoutMs milliseconds for the first one.
+ * Threads of harvested calls are joined, their m_nResult, m_pData and m_bFinished are valid.
+ * \param pQueue - pointer to queue returned by mdz_ansi_queueCreate()
+ * \param ppCompleted - pointer to array of at least nMaxCount pointers, which receives pAsyncData of harvested calls
+ * \param nMaxCount - maximal number of calls to harvest
+ * \param nTimeoutMs - timeout of waiting in milliseconds. Use 0 to return immediately, SIZE_MAX to wait without timeout
+ * \return:
+ * 0      - if pQueue == NULL or ppCompleted == NULL or nMaxCount == 0, or no call is finished till timeout
+ * Result - number of harvested calls
+ */
+size_t mdz_ansi_queueHarvest(struct mdz_ansi_queue* pQueue, struct mdz_asyncData** ppCompleted, size_t nMaxCount, size_t nTimeoutMs);
+
+/**
+ * Return notification handle of queue, which is signalled while queue contains finished calls which are not harvested. Handle should not be read or closed by client.
+ * Under Linux handle is eventfd file descriptor, under other UNIX systems read end of pipe: both can be used with poll()/epoll()/kqueue() for readability.
+ * Under Windows handle is manual-reset event, which can be used with WaitForMultipleObjects().
+ * \param pQueue - pointer to queue returned by mdz_ansi_queueCreate()
+ * \return:
+ * -1 (NULL under Windows) - if pQueue == NULL
+ * Result                  - notification handle
+ */
+#ifdef _WIN32
+HANDLE mdz_ansi_queueHandle(const struct mdz_ansi_queue* pQueue);
+#else
+int mdz_ansi_queueHandle(const struct mdz_ansi_queue* pQueue);
+#endif
+
+/**
+ * \defgroup Scheduling functions
+ *
+ * Asynchronous calls of mdz_ansi_ext are ranked by priority class, then by deadline (earlier first, calls without deadline last).
+ * Threads of calls are time-sliced on chunk borders (every MDZ_ANSI_EXT_CANCEL_CHUNK bytes): while more threads are running than there are processors, thread waits there until
+ * less than "number of processors" threads of calls of higher rank are running. Threads of call are its own thread and worker threads started for large ranges.
+ * Calls of equal rank share processors. Thus small urgent calls are not slowed down by large background calls.
+ * Synchronous calls and asynchronous calls of mdz_ansi library itself are not scheduled.
+ */
+
+/**
+ * Priority class of asynchronous call
+ */
+enum mdz_ansi_priority
+{
+  /**
+   * Bulk processing. Runs only on processors not needed by calls of higher priority
+   */
+  MDZ_ANSI_PRIORITY_BACKGROUND = 0,
+
+  /**
+   * Default priority of calls
+   */
+  MDZ_ANSI_PRIORITY_NORMAL,
+
+  /**
+   * Latency-critical calls
+   */
+  MDZ_ANSI_PRIORITY_URGENT
+};
+
+/**
+ * Set priority class and deadline of the next asynchronous call made with pAsyncData. Must be called before the call. Parameters are used by one call only (by the next call of
+ * mdz_ansi_ext with pAsyncData, which starts its thread), following calls are made with MDZ_ANSI_PRIORITY_NORMAL without deadline unless parameters are set again.
+ * If the next call fails before its thread is started (string is NULL, or thread cannot be started), parameters are dropped too, thus re-used pAsyncData does not inherit them.
+ * Deadline is used only for ranking of calls: call is not cancelled if deadline expires.
+ * \param pAsyncData - pointer to async data of call
+ * \param enPriority - priority class of call
+ * \param nDeadlineMs - deadline in milliseconds, counted from start of call. Use SIZE_MAX for call without deadline
+ * \return:
+ * mdz_false - if pAsyncData == NULL, or enPriority is invalid, or memory allocation failed
+ * mdz_true  - if succeeded
+ */
+mdz_bool mdz_ansi_asyncSetPriority(const struct mdz_asyncData* pAsyncData, enum mdz_ansi_priority enPriority, size_t nDeadlineMs);
+
+/**
+ * \defgroup Statistics functions
+ */
+
+/**
+ * Functions of mdz_ansi_ext, for which statistics are collected. Index in m_aFuncs of mdz_ansi_stats
+ */
+enum mdz_ansi_stats_func
+{
+  MDZ_ANSI_STATS_TOLOWER = 0,
+  MDZ_ANSI_STATS_TOUPPER,
+  MDZ_ANSI_STATS_TRANSLATE,
+  MDZ_ANSI_STATS_REMOVEANYOF,
+  MDZ_ANSI_STATS_REMOVEALL,
+  MDZ_ANSI_STATS_COPYLOWER,
+  MDZ_ANSI_STATS_COPYUPPER,
+  MDZ_ANSI_STATS_COPYTRANSLATED,
+  MDZ_ANSI_STATS_COPYWITHOUTANYOF,
+  MDZ_ANSI_STATS_TRIMLEFTFAST,
+  MDZ_ANSI_STATS_TRIMRIGHTFAST,
+  MDZ_ANSI_STATS_TRIMFAST,
+  MDZ_ANSI_STATS_TRIMBOUNDS,
+  MDZ_ANSI_STATS_FINDFAST,
+  MDZ_ANSI_STATS_RFINDFAST,
+  MDZ_ANSI_STATS_RFINDSINGLEFAST,
+  MDZ_ANSI_STATS_RESERVEANDINITFAST,
+  MDZ_ANSI_STATS_COPYFAST,
+  MDZ_ANSI_STATS_HISTOGRAM,
+  MDZ_ANSI_STATS_COUNTANYOF,
+  MDZ_ANSI_STATS_FINDCLASS,
+
+  /**
+   * Number of functions
+   */
+  MDZ_ANSI_STATS_FUNC_COUNT
+};
+
+/**
+ * Kernels selected for search/scan of data. Index in m_aKernels of mdz_ansi_stats
+ */
+enum mdz_ansi_stats_kernel
+{
+  MDZ_ANSI_STATS_KERNEL_SCALAR = 0,
+  MDZ_ANSI_STATS_KERNEL_SSE2,
+  MDZ_ANSI_STATS_KERNEL_AVX2,
+
+  /**
+   * Number of kernels
+   */
+  MDZ_ANSI_STATS_KERNEL_COUNT
+};
+
+/**
+ * Number of buckets in call latency histogram
+ */
+#define MDZ_ANSI_STATS_LATENCY_BUCKETS 32
+
+/**
+ * Statistics of one function
+ */
+struct mdz_ansi_statsFunc
+{
+  /**
+   * Number of calls (including asynchronous calls and calls with invalid parameters)
+   */
+  size_t m_nCalls;
+
+  /**
+   * Number of asynchronous calls
+   */
+  size_t m_nAsyncCalls;
+
+  /**
+   * Number of calls finished with m_enErrorCode other than MDZ_ERROR_NONE
+   */
+  size_t m_nErrors;
+
+  /**
+   * Sum of sizes of processed ranges in bytes. Ranges of calls finished with error are not counted
+   */
+  size_t m_nBytes;
+
+  /**
+   * Sum of call durations in nanoseconds, while timing is enabled (see mdz_ansi_statsEnableTiming()). Duration of asynchronous call is measured from start till end of its thread
+   */
+  uint64_t m_nNanoseconds;
+};
+
+/**
+ * Statistics of mdz_ansi_ext calls, summed over all threads
+ */
+struct mdz_ansi_stats
+{
+  /**
+   * Statistics of functions, indexed with mdz_ansi_stats_func
+   */
+  struct mdz_ansi_statsFunc m_aFuncs[MDZ_ANSI_STATS_FUNC_COUNT];
+
+  /**
+   * Number of selections of search/scan kernels (one per call of search function), indexed with mdz_ansi_stats_kernel
+   */
+  size_t m_aKernels[MDZ_ANSI_STATS_KERNEL_COUNT];
+
+  /**
+   * Number of calls, which increased Capacity of destination string
+   */
+  size_t m_nReallocations;
+
+  /**
+   * Sum of Capacity increases of destination strings in bytes
+   */
+  size_t m_nAllocatedBytes;
+
+  /**
+   * Number of threads started for asynchronous calls
+   */
+  size_t m_nAsyncThreads;
+
+  /**
+   * Number of worker threads started for splitting of large ranges
+   */
+  size_t m_nWorkerThreads;
+
+  /**
+   * Call latency histogram of calls made while timing is enabled: bucket 0 counts calls shorter than 2 nanoseconds, bucket i counts calls of [2^i, 2^(i+1)) nanoseconds, last bucket counts also all longer calls
+   */
+  size_t m_aLatency[MDZ_ANSI_STATS_LATENCY_BUCKETS];
+};
+
+/**
+ * Callback called after every call of mdz_ansi_ext function while statistics are enabled, on thread which executed the call.
+ * \param enFunc - called function
+ * \param nBytes - size of processed range in bytes
+ * \param nNanoseconds - duration of call in nanoseconds, or 0 if timing is disabled
+ * \param enError - m_enErrorCode of string after call
+ * \param pContext - pContext passed in mdz_ansi_statsSetCallback()
+ */
+typedef void (*mdz_ansi_statsCallback)(enum mdz_ansi_stats_func enFunc, size_t nBytes, uint64_t nNanoseconds, enum mdz_error_code enError, void* pContext);
+
+/**
+ * Enable or disable collecting of statistics. Statistics are collected only if mdz_ansi_ext source files are compiled with MDZ_ANSI_EXT_STATS defined, otherwise calls have no overhead.
+ * Counters are kept per thread without locks, thus collecting costs several increments per call, plus two clock reads if timing is enabled (see mdz_ansi_statsEnableTiming()).
+ * \param bEnable - mdz_true to enable, mdz_false to disable collecting
+ * \return:
+ * mdz_false - if mdz_ansi_ext is compiled without MDZ_ANSI_EXT_STATS
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_statsEnable(mdz_bool bEnable);
+
+/**
+ * Enable or disable measuring of call durations (m_nNanoseconds, m_aLatency and nNanoseconds of callback). Timing is disabled by default, because two clock reads
+ * usually cost more than the rest of statistics of short call. Has effect only while statistics are enabled (see mdz_ansi_statsEnable()).
+ * \param bEnable - mdz_true to enable, mdz_false to disable timing
+ * \return:
+ * mdz_false - if mdz_ansi_ext is compiled without MDZ_ANSI_EXT_STATS
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_statsEnableTiming(mdz_bool bEnable);
+
+/**
+ * Fill pStats with statistics summed over all threads since start of process. Counters are never reset: use differences of two snapshots for statistics of interval.
+ * Counters of other threads may be updated during snapshot, thus snapshot is not atomic, but every counter is read whole: on platforms, where 64-bit counters are written
+ * with two stores, counters of thread, which were changed during reading, are read again.
+ * \param pStats - pointer to statistics to fill
+ * \return:
+ * mdz_false - if pStats == NULL, or mdz_ansi_ext is compiled without MDZ_ANSI_EXT_STATS
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_statsSnapshot(struct mdz_ansi_stats* pStats);
+
+/**
+ * Set callback called after every call of mdz_ansi_ext function while statistics are enabled. May be set while mdz_ansi_ext calls are executed: callback is always called with
+ * pContext set together with it, but calls, which are finishing during replacement, may still call previous callback. Every different pair of pfnCallback and pContext
+ * keeps a few bytes of memory till process exit.
+ * \param pfnCallback - callback, or NULL to remove callback
+ * \param pContext - pointer passed to callback
+ * \return:
+ * mdz_false - if mdz_ansi_ext is compiled without MDZ_ANSI_EXT_STATS
+ * mdz_false - if memory allocation failed. Previous callback is kept
+ * mdz_true  - operation succeeded
+ */
+mdz_bool mdz_ansi_statsSetCallback(mdz_ansi_statsCallback pfnCallback, void* pContext);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif